@@ -0,0 +1,67 @@
+#include <algorithm>  // for std::sort, std::stable_sort
+#include <chrono>     // for std::chrono::steady_clock
+#include <cstdlib>    // for std::atoll
+#include <iostream>   // for std::cout
+#include <random>     // for std::mt19937
+#include <string>     // for std::string
+#include <vector>     // for std::vector
+#include "SortKeys.h"
+using namespace std;
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = chrono::steady_clock::now();
+  f();
+  auto end = chrono::steady_clock::now();
+  return chrono::duration<double, milli>(end - begin).count();
+}
+
+// Random lines in the spirit of `data.txt`: varied lengths, some sharing a long common start
+vector<string> MakeLines(size_t count) {
+  mt19937 gen{ 2017 };
+  uniform_int_distribution<int> length(0, 80);
+  uniform_int_distribution<int> ch(' ', '~');
+  uniform_int_distribution<int> coin(0, 3);
+
+  vector<string> lines;
+  lines.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    string s = coin(gen) == 0 ? "C++ is a great language! " : "";
+    for (int n = length(gen); n > 0; n--) {
+      s.push_back(static_cast<char>(ch(gen)));
+    }
+    lines.push_back(move(s));
+  }
+  return lines;
+}
+
+int main(int argc, char* argv[]) {
+  // usage: PrefixKeySort [lines]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 2'000'000;
+  const auto lines = MakeLines(count);
+  cout << " Sorting " << count << " lines \n\n";
+
+  // Lexicographic order, as in `ReadLines.cpp`
+  auto a = lines;
+  double lambdaMs = TimeMs([&] { sort(begin(a), end(a)); });
+  auto b = lines;
+  double keyMs = TimeMs([&] { SortLinesByPrefixKey(b); });
+  cout << " Lexicographic -- std::sort(): " << lambdaMs << " ms, prefix keys: " << keyMs
+       << " ms (speedup " << lambdaMs / keyMs << "x)" << (a == b ? "" : " -- MISMATCH!") << '\n';
+  bool ok = a == b;
+
+  // By length, as in `ReadLinesLambdaSort.cpp`
+  a = lines;
+  lambdaMs = TimeMs([&] {
+    sort(begin(a), end(a), [](auto const& x, auto const& y) { return x.length() < y.length(); });
+  });
+  b = lines;
+  keyMs = TimeMs([&] { SortLinesByLengthKey(b); });
+  a = lines; // `std::sort()` is not stable, so check against `std::stable_sort()` (untimed)
+  stable_sort(begin(a), end(a), [](auto const& x, auto const& y) { return x.length() < y.length(); });
+  cout << " By length     -- lambda:      " << lambdaMs << " ms, prefix keys: " << keyMs
+       << " ms (speedup " << lambdaMs / keyMs << "x)" << (a == b ? "" : " -- MISMATCH!") << '\n';
+  ok = ok && a == b;
+
+  return ok ? 0 : 1;
+}
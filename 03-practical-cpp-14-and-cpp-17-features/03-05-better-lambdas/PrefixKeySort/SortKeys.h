@@ -0,0 +1,141 @@
+#pragma once
+#include <algorithm>  // for std::sort, std::stable_sort
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::uint64_t, std::uint32_t
+#include <string>     // for std::string
+#include <iterator>   // for std::begin, std::end
+#include <utility>    // for std::move
+#include <vector>     // for std::vector
+
+// Compact, cache-resident sort record: 16 bytes per line instead of a pointer chase per compare
+struct LineKey {
+  std::uint64_t prefix;  // first 8 characters, big-endian, zero padded
+  std::uint32_t length;  // line length (saturated at 2^32 - 1)
+  std::uint32_t index;   // position of the line in the original vector
+};
+
+// `LineKey::index` can't address more lines than this: the sorts below fall back to the Standard
+// Library beyond it
+inline bool FitsLineKeys(const std::vector<std::string>& lines) { return lines.size() <= UINT32_MAX; }
+
+inline std::uint64_t PrefixOf(const std::string& s) {
+  std::uint64_t prefix = 0;
+  for (std::size_t i = 0; i < 8; i++) {
+    unsigned char c = i < s.size() ? static_cast<unsigned char>(s[i]) : 0;
+    prefix = (prefix << 8) | c;
+  }
+  return prefix;
+}
+
+inline std::vector<LineKey> MakeLineKeys(const std::vector<std::string>& lines) {
+  std::vector<LineKey> keys(lines.size());
+  for (std::size_t i = 0; i < lines.size(); i++) {
+    auto length = std::min<std::size_t>(lines[i].size(), UINT32_MAX);
+    keys[i] = { PrefixOf(lines[i]), static_cast<std::uint32_t>(length), static_cast<std::uint32_t>(i) };
+  }
+  return keys;
+}
+
+// Stable LSD radix sort of the records on the low `bytes` bytes of `keyOf(record)`;
+// passes in which every record has the same digit are skipped
+template <typename KeyOf>
+void RadixSortLineKeys(std::vector<LineKey>& keys, KeyOf keyOf, int bytes) {
+  std::vector<LineKey> buffer(keys.size());
+  for (int pass = 0; pass < bytes; pass++) {
+    const int shift = 8 * pass;
+    std::size_t count[256] = {};
+    for (const auto& k : keys) {
+      count[(keyOf(k) >> shift) & 0xFF]++;
+    }
+    if (std::find(std::begin(count), std::end(count), keys.size()) != std::end(count)) {
+      continue;
+    }
+    std::size_t offset = 0;
+    for (auto& c : count) {
+      std::size_t n = c;
+      c = offset;
+      offset += n;
+    }
+    for (const auto& k : keys) {
+      buffer[count[(keyOf(k) >> shift) & 0xFF]++] = k;
+    }
+    keys.swap(buffer);
+  }
+}
+
+// Moves the lines into the order given by `keys` (keys[i].index is the line that goes to position i);
+// every line is moved exactly once, never copied
+inline void ApplyLineKeys(std::vector<std::string>& lines, const std::vector<LineKey>& keys) {
+  std::vector<std::string> sorted;
+  sorted.reserve(lines.size());
+  for (const auto& k : keys) {
+    sorted.push_back(std::move(lines[k.index]));
+  }
+  lines.swap(sorted);
+}
+
+// Same order as `std::sort(begin(lines), end(lines))`
+inline void SortLinesByPrefixKey(std::vector<std::string>& lines) {
+  if (!FitsLineKeys(lines)) {
+    std::sort(lines.begin(), lines.end());
+    return;
+  }
+  auto keys = MakeLineKeys(lines);
+  RadixSortLineKeys(keys, [](const LineKey& k) { return k.prefix; }, 8);
+
+  // Only runs of equal prefixes need to look at lengths, and (rarely) at the lines themselves
+  auto tieBreak = [&lines](const LineKey& a, const LineKey& b) {
+    if (a.length <= 8 || b.length <= 8) {
+      return a.length < b.length; // the prefix covers the whole of the shorter line
+    }
+    return lines[a.index].compare(8, std::string::npos, lines[b.index], 8, std::string::npos) < 0;
+  };
+  for (auto first = begin(keys); first != end(keys);) {
+    auto last = first + 1;
+    while (last != end(keys) && last->prefix == first->prefix) {
+      ++last;
+    }
+    if (last - first > 1) {
+      std::sort(first, last, tieBreak);
+    }
+    first = last;
+  }
+  ApplyLineKeys(lines, keys);
+}
+
+// Shorter lines first; lines of equal length keep their original relative order (like `std::stable_sort()`)
+inline void SortLinesByLengthKey(std::vector<std::string>& lines) {
+  // `length()` lives in the string object itself, so the comparison never chased a pointer; what
+  // costs time is moving strings around. With typical line lengths, a counting sort on the cached
+  // lengths moves every line exactly once, reading `lines` sequentially
+  const std::size_t maxCountedLength = 1 << 16;
+  std::vector<std::uint32_t> lengths(lines.size());
+  std::size_t longest = 0;
+  for (std::size_t i = 0; i < lines.size(); i++) {
+    lengths[i] = static_cast<std::uint32_t>(std::min<std::size_t>(lines[i].size(), UINT32_MAX));
+    longest = std::max<std::size_t>(longest, lengths[i]);
+  }
+  if (!FitsLineKeys(lines) || longest == UINT32_MAX) { // too many lines to index, or saturated lengths
+    std::stable_sort(lines.begin(), lines.end(), [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+    return;
+  }
+  if (longest >= maxCountedLength) {
+    auto keys = MakeLineKeys(lines);
+    RadixSortLineKeys(keys, [](const LineKey& k) { return k.length; }, 4);
+    ApplyLineKeys(lines, keys);
+    return;
+  }
+
+  std::vector<std::size_t> offset(longest + 2, 0);
+  for (auto n : lengths) {
+    offset[n + 1]++;
+  }
+  for (std::size_t n = 1; n < offset.size(); n++) {
+    offset[n] += offset[n - 1];
+  }
+  std::vector<std::string> sorted(lines.size());
+  for (std::size_t i = 0; i < lines.size(); i++) {
+    sorted[offset[lengths[i]]++] = std::move(lines[i]);
+  }
+  lines.swap(sorted);
+}
@@ -0,0 +1,85 @@
+// Demo: Parallel multikey quicksort for std::vector<std::string> vs. std::sort()
+
+#include <algorithm>
+using std::sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+#ifdef USE_EXECUTION_PAR
+#include <execution> // N.B. with GCC's libstdc++, parallel policies need TBB (`make par`)
+#endif
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+#include <thread>
+using std::thread;
+#include <vector>
+using std::vector;
+
+#include "StringSort.h"
+
+
+template <typename Func>
+long long TimeFunc(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration_cast<milliseconds>(end - begin).count();
+}
+
+// Generates "log-like" lines: a few shared prefixes followed by random text, so many
+// comparisons have to look past the first handful of characters
+vector<string> MakeLines(size_t count) {
+  const vector<string> prefixes{ "", "C++ ", "Connie ", "https://www.pluralsight.com/", "2019-09-30 INFO " };
+  mt19937 gen{ 2019 };
+  uniform_int_distribution<size_t> pickPrefix(0, prefixes.size() - 1);
+  uniform_int_distribution<int> length(1, 40);
+  uniform_int_distribution<int> letter('a', 'z');
+
+  vector<string> lines;
+  lines.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    string s = prefixes[pickPrefix(gen)];
+    int n = length(gen);
+    for (int k = 0; k < n; k++) {
+      s.push_back(static_cast<char>(letter(gen)));
+    }
+    lines.push_back(std::move(s));
+  }
+  return lines;
+}
+
+int main(int argc, char* argv[]) {
+  // usage: ParallelStringSort [lines] -- e.g., 1000000, 10000000, 100000000
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  cout << " Sorting " << count << " lines using " << thread::hardware_concurrency() << " hardware threads \n\n";
+
+  const vector<string> lines = MakeLines(count);
+
+  auto expected = lines;
+  auto stdSortMs = TimeFunc([&]() { sort(begin(expected), end(expected)); });
+  cout << " std::sort()                : " << stdSortMs << " ms \n";
+
+#ifdef USE_EXECUTION_PAR
+  auto parallel = lines;
+  auto parSortMs = TimeFunc([&]() { sort(std::execution::par, begin(parallel), end(parallel)); });
+  cout << " std::sort(execution::par)  : " << parSortMs << " ms \n";
+#endif
+
+  auto radix = lines;
+  auto radixMs = TimeFunc([&]() { ParallelStringSort(radix); });
+  cout << " ParallelStringSort()       : " << radixMs << " ms \n\n";
+
+  cout << (radix == expected ? " Results match std::sort(). \n" : " ERROR: results differ from std::sort()! \n");
+
+  return radix == expected ? 0 : 1;
+}
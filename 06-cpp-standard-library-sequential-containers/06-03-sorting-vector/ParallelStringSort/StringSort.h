@@ -0,0 +1,156 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+  Multikey quicksort for `std::vector<std::string>` with inline prefix caching
+
+  Instead of comparing whole strings (`memcmp` plus a pointer chase into the
+  heap on every comparison, as `std::sort()` does), each string gets a small
+  record holding the next 8 characters of the string as a big-endian integer
+  ("superchar"), so almost all comparisons are plain integer comparisons on
+  a contiguous array; the string itself is only touched again when a group of
+  records shares the same 8 characters and must be refilled one level deeper
+*/
+
+struct StringSortRecord {
+  std::uint64_t key;  // next 8 characters starting at the current depth (zero padded)
+  std::size_t length; // full string length, used to break ties between zero padding and real '\0' characters
+  std::string* s;     // source string, moved into place once sorting is done
+};
+
+// Packs up to 8 characters of `s` starting at `depth` into a big-endian integer
+inline std::uint64_t LoadStringKey(const std::string& s, std::size_t depth) {
+  std::uint64_t key = 0;
+  std::size_t n = depth < s.size() ? std::min<std::size_t>(s.size() - depth, 8) : 0;
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data()) + depth;
+  for (std::size_t i = 0; i < 8; i++) {
+    key = (key << 8) | (i < n ? p[i] : 0u);
+  }
+  return key;
+}
+
+// Number of real characters covered by the key at `depth` (0..8)
+inline std::size_t KeyLength(const StringSortRecord& r, std::size_t depth) {
+  return r.length > depth ? std::min<std::size_t>(r.length - depth, 8) : 0;
+}
+
+// Three-way comparison of two records at `depth`: (key, covered length)
+inline int CompareRecords(const StringSortRecord& a, const StringSortRecord& b, std::size_t depth) {
+  if (a.key != b.key) {
+    return a.key < b.key ? -1 : 1;
+  }
+  std::size_t la = KeyLength(a, depth);
+  std::size_t lb = KeyLength(b, depth);
+  return la == lb ? 0 : (la < lb ? -1 : 1);
+}
+
+// Small partitions: insertion sort comparing the remaining suffixes directly
+inline void InsertionSortRecords(StringSortRecord* a, std::size_t n, std::size_t depth) {
+  for (std::size_t i = 1; i < n; i++) {
+    StringSortRecord r = a[i];
+    std::size_t j = i;
+    while (j > 0) {
+      int c = CompareRecords(r, a[j - 1], depth);
+      if (c == 0 && KeyLength(r, depth) == 8) {
+        c = r.s->compare(depth + 8, std::string::npos, *a[j - 1].s, depth + 8, std::string::npos);
+      }
+      if (c >= 0) {
+        break;
+      }
+      a[j] = a[j - 1];
+      j--;
+    }
+    a[j] = r;
+  }
+}
+
+// Multikey quicksort over the records; spawns tasks for large partitions while `spawnDepth > 0`
+inline void MultikeyQuicksort(StringSortRecord* a, std::size_t n, std::size_t depth, int spawnDepth) {
+  const std::size_t insertionThreshold = 16;
+  const std::size_t taskThreshold = 1 << 15;
+
+  std::vector<std::future<void>> tasks;
+  while (n > insertionThreshold) {
+    // median of three as pivot
+    StringSortRecord* lo = a;
+    StringSortRecord* mid = a + n / 2;
+    StringSortRecord* hi = a + n - 1;
+    if (CompareRecords(*mid, *lo, depth) < 0) std::swap(*mid, *lo);
+    if (CompareRecords(*hi, *mid, depth) < 0) std::swap(*hi, *mid);
+    if (CompareRecords(*mid, *lo, depth) < 0) std::swap(*mid, *lo);
+    StringSortRecord pivot = *mid;
+
+    // three-way (Dutch national flag) partition: [0, lt) < pivot, [lt, gt) == pivot, [gt, n) > pivot
+    std::size_t lt = 0, i = 0, gt = n;
+    while (i < gt) {
+      int c = CompareRecords(a[i], pivot, depth);
+      if (c < 0) {
+        std::swap(a[lt++], a[i++]);
+      } else if (c > 0) {
+        std::swap(a[i], a[--gt]);
+      } else {
+        i++;
+      }
+    }
+
+    auto recurse = [&](StringSortRecord* p, std::size_t m, std::size_t d) {
+      if (spawnDepth > 0 && m > taskThreshold) {
+        tasks.push_back(std::async(std::launch::async, MultikeyQuicksort, p, m, d, spawnDepth - 1));
+      } else {
+        MultikeyQuicksort(p, m, d, spawnDepth);
+      }
+    };
+    recurse(a, lt, depth);
+    recurse(a + gt, n - gt, depth);
+
+    // The equal group shares its first 8 characters; if they were all real characters, go one level deeper
+    std::size_t m = gt - lt;
+    if (m <= 1 || KeyLength(pivot, depth) < 8) {
+      n = 0;
+      break;
+    }
+    a += lt;
+    n = m;
+    depth += 8;
+    for (std::size_t k = 0; k < n; k++) {
+      a[k].key = LoadStringKey(*a[k].s, depth);
+    }
+  }
+  if (n > 1) {
+    InsertionSortRecords(a, n, depth);
+  }
+  for (auto& t : tasks) {
+    t.get();
+  }
+}
+
+// Sorts `lines` lexicographically (same order as `std::sort()`), using up to `threads` threads
+inline void ParallelStringSort(std::vector<std::string>& lines,
+                               unsigned threads = std::thread::hardware_concurrency()) {
+  std::vector<StringSortRecord> records(lines.size());
+  for (std::size_t i = 0; i < lines.size(); i++) {
+    records[i] = { LoadStringKey(lines[i], 0), lines[i].size(), &lines[i] };
+  }
+
+  // allow roughly 4 tasks per thread, so uneven partitions still keep every thread busy
+  int spawnDepth = 0;
+  while (threads > 1 && (1u << spawnDepth) < threads * 4) {
+    spawnDepth++;
+  }
+  MultikeyQuicksort(records.data(), records.size(), 0, spawnDepth);
+
+  // permute the strings once, moving (not copying) them into sorted order
+  std::vector<std::string> sorted;
+  sorted.reserve(lines.size());
+  for (const auto& r : records) {
+    sorted.push_back(std::move(*r.s));
+  }
+  lines.swap(sorted);
+}
@@ -0,0 +1,132 @@
+#include "CaseInsensitiveIndex.h"
+#include <algorithm>
+using std::lower_bound;
+using std::remove;
+#include <string>
+using std::string;
+#include <string_view>
+using std::string_view;
+#include <utility>
+using std::move;
+#include <vector>
+using std::vector;
+
+
+namespace {
+
+inline char FoldCase(char c) {
+  return static_cast<unsigned char>(c - 'A') < 26 ? static_cast<char>(c | 0x20) : c;
+}
+
+} // namespace
+
+CaseInsensitiveIndex::CaseInsensitiveIndex(vector<string> v) : items(move(v)) {
+  Rebuild();
+}
+
+std::uint64_t CaseInsensitiveIndex::FoldedHash(string_view s) {
+  std::uint64_t h = 14695981039346656037ull; // FNV-1a over the lowercased characters
+  for (char c : s) {
+    h ^= static_cast<unsigned char>(FoldCase(c));
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+bool CaseInsensitiveIndex::FoldedEquals(string_view s1, string_view s2) {
+  if (s1.size() != s2.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < s1.size(); i++) {
+    if (FoldCase(s1[i]) != FoldCase(s2[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t CaseInsensitiveIndex::Find(string_view s) const {
+  if (!indexed) {
+    for (std::size_t i = 0; i < items.size(); i++) {
+      if (FoldedEquals(items[i], s)) {
+        return i;
+      }
+    }
+    return npos;
+  }
+
+  auto it = index.find(FoldedHash(s));
+  if (it == end(index)) {
+    return npos;
+  }
+  for (auto pos : it->second) { // more than one candidate only for duplicates or hash collisions
+    if (FoldedEquals(items[pos], s)) {
+      return pos;
+    }
+  }
+  return npos;
+}
+
+void CaseInsensitiveIndex::PushBack(string s) {
+  items.push_back(move(s));
+  if (indexed) {
+    AddToIndex(items.size() - 1); // appending never shifts existing positions: O(1)
+  } else if (items.size() >= LinearScanLimit) {
+    Rebuild();
+  }
+}
+
+void CaseInsensitiveIndex::Insert(std::size_t pos, string s) {
+  items.insert(begin(items) + pos, move(s));
+  if (indexed) {
+    // `std::vector::insert()` already shifts the tail, so shifting the indexed positions keeps the same O(n) cost
+    ShiftPositions(pos, +1);
+    AddToIndex(pos);
+  } else if (items.size() >= LinearScanLimit) {
+    Rebuild();
+  }
+}
+
+void CaseInsensitiveIndex::Erase(std::size_t pos) {
+  if (indexed) {
+    auto it = index.find(FoldedHash(items[pos]));
+    auto& positions = it->second;
+    positions.erase(remove(begin(positions), end(positions), pos), end(positions));
+    if (positions.empty()) {
+      index.erase(it);
+    }
+    ShiftPositions(pos + 1, -1);
+  }
+  items.erase(begin(items) + pos);
+  if (indexed && items.size() < LinearScanLimit) {
+    index.clear();
+    indexed = false;
+  }
+}
+
+void CaseInsensitiveIndex::Rebuild() {
+  index.clear();
+  indexed = items.size() >= LinearScanLimit;
+  if (!indexed) {
+    return;
+  }
+  index.reserve(items.size());
+  for (std::size_t i = 0; i < items.size(); i++) {
+    index[FoldedHash(items[i])].push_back(i); // ascending, since `i` only grows
+  }
+}
+
+void CaseInsensitiveIndex::AddToIndex(std::size_t pos) {
+  auto& positions = index[FoldedHash(items[pos])];
+  positions.insert(lower_bound(begin(positions), end(positions), pos), pos);
+}
+
+void CaseInsensitiveIndex::ShiftPositions(std::size_t from, std::ptrdiff_t delta) {
+  for (auto& entry : index) {
+    for (auto& p : entry.second) {
+      if (p >= from) {
+        p += delta;
+      }
+    }
+  }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+  A `std::vector<std::string>` plus a hash index keyed by the case-folded (ASCII) hash of each
+  element, so repeated case-insensitive lookups cost O(1) instead of an O(n) `std::find_if()`
+
+  The index is kept in sync by the member functions that modify the vector; vectors with fewer
+  than `LinearScanLimit` elements are not indexed at all, since a linear scan is faster there
+*/
+class CaseInsensitiveIndex
+{
+public:
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+  static constexpr std::size_t LinearScanLimit = 16;
+
+  CaseInsensitiveIndex() = default;
+  explicit CaseInsensitiveIndex(std::vector<std::string> v);
+
+  // Position of the first element equal to `s` ignoring case, or `npos`
+  std::size_t Find(std::string_view s) const;
+  bool Contains(std::string_view s) const { return Find(s) != npos; }
+
+  void PushBack(std::string s);
+  void Insert(std::size_t pos, std::string s); // inserts before position `pos`, like `std::vector::insert()`
+  void Erase(std::size_t pos);
+
+  const std::vector<std::string>& Items() const { return items; }
+  std::size_t Size() const { return items.size(); }
+
+  static std::uint64_t FoldedHash(std::string_view s);
+  static bool FoldedEquals(std::string_view s1, std::string_view s2);
+
+private:
+  void Rebuild();
+  void AddToIndex(std::size_t pos);
+  void ShiftPositions(std::size_t from, std::ptrdiff_t delta); // positions >= `from` move by `delta`
+
+  std::vector<std::string> items;
+  std::unordered_map<std::uint64_t, std::vector<std::size_t>> index; // folded hash -> ascending positions
+  bool indexed = false;
+};
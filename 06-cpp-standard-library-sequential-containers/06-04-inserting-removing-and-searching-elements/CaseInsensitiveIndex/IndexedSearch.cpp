@@ -0,0 +1,106 @@
+// Demo: Repeated case-insensitive searches -- std::find_if vs. a case-folded hash index
+
+#include <algorithm>
+using std::equal;
+using std::find_if;
+#include <cctype>
+using std::tolower;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+using std::to_string;
+#include <vector>
+using std::vector;
+
+#include "CaseInsensitiveIndex.h"
+
+
+// The predicate from `VecSearchCaseInsensitive.cpp`
+inline bool CaseInsensitiveEquals(const string& s1, const string& s2) {
+  return equal(
+    begin(s1), end(s1),
+    begin(s2), end(s2),
+    [](char ch1, char ch2) {
+      return tolower(ch1) == tolower(ch2);
+    }
+  );
+}
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[]) {
+  // usage: IndexedSearch [elements] [queries]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000;
+  size_t queries = argc > 2 ? static_cast<size_t>(atoll(argv[2])) : 1'000'000;
+
+  // The small list from the original demo: below the limit, lookups are a plain linear scan
+  CaseInsensitiveIndex small{ {"Galileo", "C64", "Connie", "Amiga", "C++"} };
+  cout << " Small vector: \"amiga\" at position " << small.Find("amiga") << ", \"CONNIE\" at position " << small.Find("CONNIE") << "\n\n";
+
+  vector<string> v;
+  v.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    v.push_back("Computer-" + to_string(i));
+  }
+  CaseInsensitiveIndex indexed{ v };
+
+  mt19937 gen{ 64 };
+  uniform_int_distribution<size_t> pick(0, 2 * count); // about half the queries miss
+  vector<string> q;
+  q.reserve(queries);
+  for (size_t i = 0; i < queries; i++) {
+    q.push_back("COMPUTER-" + to_string(pick(gen)));
+  }
+
+  // A linear scan per query is far too slow to run all the queries, so time a sample
+  size_t sample = std::min<size_t>(queries, 200);
+  size_t linearHits = 0;
+  double linearMs = TimeMs([&]() {
+    for (size_t i = 0; i < sample; i++) {
+      auto pos = find_if(begin(v), end(v), [&](const auto& x) { return CaseInsensitiveEquals(x, q[i]); });
+      linearHits += pos != end(v);
+    }
+  });
+  size_t indexHits = 0;
+  double indexMs = TimeMs([&]() {
+    for (const auto& s : q) {
+      indexHits += indexed.Contains(s);
+    }
+  });
+  size_t sampleHits = 0;
+  for (size_t i = 0; i < sample; i++) {
+    sampleHits += indexed.Contains(q[i]);
+  }
+
+  cout << ' ' << count << " elements: \n";
+  cout << "\tfind_if():             " << linearMs * 1e6 / sample << " ns/query (" << sample << " queries) \n";
+  cout << "\tCaseInsensitiveIndex:  " << indexMs * 1e6 / queries << " ns/query (" << queries << " queries, "
+       << indexHits << " found) \n";
+  bool ok = sampleHits == linearHits;
+
+  // The index follows inserts and erases
+  indexed.Insert(0, "Amiga 500");
+  indexed.Erase(indexed.Find("computer-0"));
+  indexed.PushBack("Commodore 64");
+  ok = ok && indexed.Find("AMIGA 500") == 0 && indexed.Find("Computer-1") == 1 && !indexed.Contains("computer-0") &&
+    indexed.Find("commodore 64") == indexed.Size() - 1;
+  cout << (ok ? "\n Index and linear scan agree. \n" : "\n ERROR: index out of sync! \n");
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+  ASCII case-insensitive comparison and search
+
+  Like `CaseInsensitiveEquals()` in `VecSearchCaseInsensitive.cpp`, these only fold 'A'-'Z'
+  (no locale, no UTF-8), but they lowercase a whole block of characters per instruction:
+  32 bytes with AVX2, 16 bytes with SSE2, otherwise one character at a time
+  (build with `-march=native` to let the compiler pick the widest available)
+*/
+
+inline char AsciiToLower(char c) {
+  return static_cast<unsigned char>(c - 'A') < 26 ? static_cast<char>(c | 0x20) : c;
+}
+
+#if defined(__AVX2__)
+using CaseFoldBlock = __m256i;
+constexpr std::size_t kCaseFoldBlockSize = 32;
+constexpr std::uint32_t kCaseFoldFullMask = 0xFFFFFFFFu;
+
+inline CaseFoldBlock LoadBlock(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+inline CaseFoldBlock SplatBlock(char c) { return _mm256_set1_epi8(c); }
+inline std::uint32_t EqualMask(CaseFoldBlock a, CaseFoldBlock b) {
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+}
+inline CaseFoldBlock LowerBlock(CaseFoldBlock x) {
+  // shift 'A'..'Z' to the bottom of the signed range, so one signed compare finds the upper-case letters
+  CaseFoldBlock shifted = _mm256_add_epi8(x, _mm256_set1_epi8(static_cast<char>(128 - 'A')));
+  CaseFoldBlock isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+  return _mm256_or_si256(x, _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+}
+#elif defined(__SSE2__)
+using CaseFoldBlock = __m128i;
+constexpr std::size_t kCaseFoldBlockSize = 16;
+constexpr std::uint32_t kCaseFoldFullMask = 0xFFFFu;
+
+inline CaseFoldBlock LoadBlock(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline CaseFoldBlock SplatBlock(char c) { return _mm_set1_epi8(c); }
+inline std::uint32_t EqualMask(CaseFoldBlock a, CaseFoldBlock b) {
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+}
+inline CaseFoldBlock LowerBlock(CaseFoldBlock x) {
+  CaseFoldBlock shifted = _mm_add_epi8(x, _mm_set1_epi8(static_cast<char>(128 - 'A')));
+  CaseFoldBlock isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+  return _mm_or_si128(x, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+}
+#else
+constexpr std::size_t kCaseFoldBlockSize = 0; // scalar only
+#endif
+
+// Case-insensitive (ASCII) equality of two strings
+inline bool AsciiCaseInsensitiveEquals(std::string_view s1, std::string_view s2) {
+  if (s1.size() != s2.size()) {
+    return false;
+  }
+  std::size_t i = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+  for (; i + kCaseFoldBlockSize <= s1.size(); i += kCaseFoldBlockSize) {
+    if (EqualMask(LowerBlock(LoadBlock(s1.data() + i)), LowerBlock(LoadBlock(s2.data() + i))) != kCaseFoldFullMask) {
+      return false;
+    }
+  }
+#endif
+  for (; i < s1.size(); i++) {
+    if (AsciiToLower(s1[i]) != AsciiToLower(s2[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Position of the first case-insensitive (ASCII) occurrence of `needle` in `haystack`, or npos
+inline std::size_t AsciiCaseInsensitiveFind(std::string_view haystack, std::string_view needle) {
+  const std::size_t m = needle.size();
+  if (m == 0) {
+    return 0;
+  }
+  if (m > haystack.size()) {
+    return std::string_view::npos;
+  }
+  const std::size_t last = haystack.size() - m; // last possible starting position
+  const char first = AsciiToLower(needle.front());
+  const char final = AsciiToLower(needle.back());
+  std::size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  // Filter candidate positions by matching the needle's first and last characters for a whole block
+  // of starting positions at once, then verify only the candidates
+  const CaseFoldBlock firstBlock = SplatBlock(first);
+  const CaseFoldBlock finalBlock = SplatBlock(final);
+  for (; i + kCaseFoldBlockSize <= last + 1; i += kCaseFoldBlockSize) {
+    std::uint32_t candidates =
+      EqualMask(LowerBlock(LoadBlock(haystack.data() + i)), firstBlock) &
+      EqualMask(LowerBlock(LoadBlock(haystack.data() + i + m - 1)), finalBlock);
+    while (candidates != 0) {
+      std::size_t pos = i + static_cast<std::size_t>(__builtin_ctz(candidates));
+      if (m <= 2 || AsciiCaseInsensitiveEquals(haystack.substr(pos + 1, m - 2), needle.substr(1, m - 2))) {
+        return pos;
+      }
+      candidates &= candidates - 1;
+    }
+  }
+#endif
+  for (; i <= last; i++) {
+    if (AsciiToLower(haystack[i]) == first && AsciiToLower(haystack[i + m - 1]) == final &&
+        AsciiCaseInsensitiveEquals(haystack.substr(i, m), needle)) {
+      return i;
+    }
+  }
+  return std::string_view::npos;
+}
+
+// Indices of all elements of `v` equal to `s`, ignoring (ASCII) case
+inline std::vector<std::size_t> FindAllCaseInsensitive(const std::vector<std::string>& v, std::string_view s) {
+  std::vector<std::size_t> matches;
+  for (std::size_t i = 0; i < v.size(); i++) {
+    if (v[i].size() == s.size() && AsciiCaseInsensitiveEquals(v[i], s)) {
+      matches.push_back(i);
+    }
+  }
+  return matches;
+}
+
+// Indices of all elements of `v` containing `s`, ignoring (ASCII) case
+inline std::vector<std::size_t> FindAllContainingCaseInsensitive(const std::vector<std::string>& v, std::string_view s) {
+  std::vector<std::size_t> matches;
+  for (std::size_t i = 0; i < v.size(); i++) {
+    if (AsciiCaseInsensitiveFind(v[i], s) != std::string_view::npos) {
+      matches.push_back(i);
+    }
+  }
+  return matches;
+}
@@ -0,0 +1,111 @@
+// Demo: Vectorized case-insensitive searching in std::vector<std::string> vs. std::find_if with a per-character lambda
+
+#include <algorithm>
+using std::equal;
+using std::search;
+#include <cctype>
+using std::tolower;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+
+#include "CaseFold.h"
+
+
+// The predicate from `VecSearchCaseInsensitive.cpp`
+inline bool CaseInsensitiveEquals(const string& s1, const string& s2) {
+  return equal(
+    begin(s1), end(s1),
+    begin(s2), end(s2),
+    [](char ch1, char ch2) {
+      return tolower(ch1) == tolower(ch2);
+    }
+  );
+}
+
+inline bool CaseInsensitiveContains(const string& s, const string& part) {
+  return search(begin(s), end(s), begin(part), end(part),
+    [](char ch1, char ch2) {
+      return tolower(ch1) == tolower(ch2);
+    }) != end(s);
+}
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[]) {
+  // usage: CaseInsensitiveSearch [elements]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+#if defined(__AVX2__)
+  cout << " Kernel: AVX2 (32 bytes per step) \n";
+#elif defined(__SSE2__)
+  cout << " Kernel: SSE2 (16 bytes per step) \n";
+#else
+  cout << " Kernel: scalar \n";
+#endif
+
+  // Mixed-case names of the same few lengths, so the length check alone can't reject most of them
+  const vector<string> names{ "Galileo", "C64", "Connie", "Amiga", "C++", "Commodore Amiga 500 Plus", "The Quick Brown Fox Jumps Over The Lazy Dog" };
+  mt19937 gen{ 64 };
+  uniform_int_distribution<size_t> pick(0, names.size() - 1);
+  uniform_int_distribution<int> coin(0, 1);
+  vector<string> v;
+  v.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    string s = names[pick(gen)];
+    for (auto& ch : s) {
+      if (coin(gen)) {
+        ch = static_cast<char>(tolower(ch));
+      }
+    }
+    s.back() = static_cast<char>('a' + i % 26); // mostly near-misses
+    v.push_back(s);
+  }
+  cout << ' ' << count << " strings \n\n";
+
+  for (const string query : { "AMIGA", "the quick brown fox jumps over the lazy dox" }) {
+    size_t lambdaMatches = 0;
+    double lambdaMs = TimeMs([&]() {
+      for (const auto& x : v) {
+        lambdaMatches += CaseInsensitiveEquals(x, query);
+      }
+    });
+    vector<size_t> matches;
+    double simdMs = TimeMs([&]() { matches = FindAllCaseInsensitive(v, query); });
+    cout << " equals   \"" << query << "\": lambda " << lambdaMs << " ms, FindAllCaseInsensitive() " << simdMs
+         << " ms -- " << matches.size() << " matches" << (matches.size() == lambdaMatches ? "" : " (MISMATCH!)") << '\n';
+  }
+
+  for (const string part : { "amiga", "BROWN FOX JUMPS" }) {
+    size_t lambdaMatches = 0;
+    double lambdaMs = TimeMs([&]() {
+      for (const auto& x : v) {
+        lambdaMatches += CaseInsensitiveContains(x, part);
+      }
+    });
+    vector<size_t> matches;
+    double simdMs = TimeMs([&]() { matches = FindAllContainingCaseInsensitive(v, part); });
+    cout << " contains \"" << part << "\": lambda " << lambdaMs << " ms, FindAllContainingCaseInsensitive() " << simdMs
+         << " ms -- " << matches.size() << " matches" << (matches.size() == lambdaMatches ? "" : " (MISMATCH!)") << '\n';
+  }
+
+  return 0;
+}
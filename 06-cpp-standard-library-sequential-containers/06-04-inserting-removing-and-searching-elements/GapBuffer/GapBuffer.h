@@ -0,0 +1,199 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+  Gap buffer: a sequence with the `std::vector` insertion API (`insert()` of one value, of `count`
+  copies, of a range, or of an initializer list), tuned for inserting repeatedly near a moving
+  "cursor", as an editor does
+
+  The elements live in one array with a hole (the "gap") at the last insertion point: inserting at
+  the gap costs O(1), and moving the insertion point by `d` positions only moves `d` elements,
+  instead of the whole tail that `std::vector::insert()` shifts on every call
+
+  N.B. `T` must be default constructible and move assignable (the gap holds spare `T` objects)
+*/
+template <typename T>
+class GapBuffer
+{
+  template <bool IsConst>
+  class Iterator;
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  GapBuffer() = default;
+  GapBuffer(std::initializer_list<T> init) : storage(init), gapBegin(init.size()), gapEnd(init.size()) {}
+
+  size_type size() const { return storage.size() - (gapEnd - gapBegin); }
+  bool empty() const { return size() == 0; }
+
+  T& operator[](size_type i) { return storage[Physical(i)]; }
+  const T& operator[](size_type i) const { return storage[Physical(i)]; }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  void push_back(const T& value) { insert(end(), value); }
+  void push_back(T&& value) { insert(end(), std::move(value)); }
+
+  iterator insert(const_iterator pos, const T& value) {
+    T copy(value); // `value` may refer to an element of this buffer, which moving the gap would overwrite
+    return insert(pos, std::move(copy));
+  }
+
+  iterator insert(const_iterator pos, T&& value) {
+    size_type at = pos.index;
+    OpenGap(at, 1);
+    storage[gapBegin++] = std::move(value);
+    return iterator(this, at);
+  }
+
+  iterator insert(const_iterator pos, size_type count, const T& value) {
+    T copy(value);
+    size_type at = pos.index;
+    OpenGap(at, count);
+    std::fill_n(storage.begin() + gapBegin, count, copy);
+    gapBegin += count;
+    return iterator(this, at);
+  }
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type at = pos.index;
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      OpenGap(at, count);
+      std::copy(first, last, storage.begin() + gapBegin);
+      gapBegin += count;
+      return iterator(this, at);
+    } else {
+      std::vector<T> items(first, last); // single-pass input: the count isn't known in advance
+      return insert(pos, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    }
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<T> init) { return insert(pos, init.begin(), init.end()); }
+
+  iterator erase(const_iterator pos) {
+    size_type at = pos.index;
+    MoveGap(at);
+    gapEnd++; // the element after the gap joins the gap
+    return iterator(this, at);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type at = first.index;
+    MoveGap(at);
+    gapEnd += last.index - first.index;
+    return iterator(this, at);
+  }
+
+private:
+  size_type Physical(size_type i) const { return i < gapBegin ? i : i + (gapEnd - gapBegin); }
+
+  // Moves the gap so it starts at logical position `at`: only the elements between the old and new position move
+  void MoveGap(size_type at) {
+    if (gapBegin == gapEnd) { // no gap: nothing to move (the ranges below would self-move every element)
+      gapBegin = gapEnd = at;
+    } else if (at < gapBegin) {
+      std::move_backward(storage.begin() + at, storage.begin() + gapBegin, storage.begin() + gapEnd);
+      gapEnd -= gapBegin - at;
+      gapBegin = at;
+    } else if (at > gapBegin) {
+      size_type count = at - gapBegin;
+      std::move(storage.begin() + gapEnd, storage.begin() + gapEnd + count, storage.begin() + gapBegin);
+      gapBegin = at;
+      gapEnd += count;
+    }
+  }
+
+  // Moves the gap to `at` and makes sure it can hold `count` more elements
+  void OpenGap(size_type at, size_type count) {
+    if (gapEnd - gapBegin >= count) {
+      MoveGap(at);
+      return;
+    }
+    // Grow geometrically, like `std::vector`, placing the new gap directly at `at`
+    size_type n = size();
+    size_type capacity = std::max({ storage.size() * 2, n + count, size_type{ 16 } });
+    std::vector<T> grown(capacity);
+    size_type newGapEnd = capacity - (n - at);
+    for (size_type i = 0; i < n; i++) {
+      grown[i < at ? i : newGapEnd + (i - at)] = std::move(storage[Physical(i)]);
+    }
+    storage.swap(grown);
+    gapBegin = at;
+    gapEnd = newGapEnd;
+  }
+
+  std::vector<T> storage;
+  size_type gapBegin = 0;
+  size_type gapEnd = 0;
+};
+
+// Random-access iterator: a logical position in the buffer (skips over the gap)
+template <typename T>
+template <bool IsConst>
+class GapBuffer<T>::Iterator
+{
+  using Buffer = std::conditional_t<IsConst, const GapBuffer, GapBuffer>;
+  friend class GapBuffer;
+  friend class Iterator<!IsConst>;
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+
+  Iterator() = default;
+  Iterator(Buffer* b, size_type i) : buffer(b), index(i) {}
+  template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+  Iterator(const Iterator<WasConst>& other) : buffer(other.buffer), index(other.index) {} // iterator -> const_iterator
+
+  reference operator*() const { return (*buffer)[index]; }
+  pointer operator->() const { return &(*buffer)[index]; }
+  reference operator[](difference_type n) const { return (*buffer)[index + n]; }
+
+  Iterator& operator++() { ++index; return *this; }
+  Iterator operator++(int) { Iterator old = *this; ++index; return old; }
+  Iterator& operator--() { --index; return *this; }
+  Iterator operator--(int) { Iterator old = *this; --index; return old; }
+  Iterator& operator+=(difference_type n) { index += n; return *this; }
+  Iterator& operator-=(difference_type n) { index -= n; return *this; }
+  friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+  friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+  friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+  friend difference_type operator-(const Iterator& a, const Iterator& b) {
+    return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+  }
+
+  friend bool operator==(const Iterator& a, const Iterator& b) { return a.index == b.index; }
+  friend bool operator!=(const Iterator& a, const Iterator& b) { return a.index != b.index; }
+  friend bool operator<(const Iterator& a, const Iterator& b) { return a.index < b.index; }
+  friend bool operator>(const Iterator& a, const Iterator& b) { return a.index > b.index; }
+  friend bool operator<=(const Iterator& a, const Iterator& b) { return a.index <= b.index; }
+  friend bool operator>=(const Iterator& a, const Iterator& b) { return a.index >= b.index; }
+
+private:
+  Buffer* buffer = nullptr;
+  size_type index = 0;
+};
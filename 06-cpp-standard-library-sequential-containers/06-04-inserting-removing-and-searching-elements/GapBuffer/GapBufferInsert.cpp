@@ -0,0 +1,179 @@
+// Demo: Repeated mid-sequence insertion -- std::vector::insert vs. a gap buffer and a piece table
+
+#include <array>
+using std::array;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <iterator>
+using std::begin;
+using std::end;
+#include <ostream>
+using std::ostream;
+#include <string>
+using std::string;
+using std::to_string;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <vector>
+using std::vector;
+
+#include "GapBuffer.h"
+#include "PieceTable.h"
+
+
+template <typename Sequence>
+void Print(ostream& os, const Sequence& v) {
+  os << "[ ";
+  for (const auto& x : v) {
+    os << x << ' ';
+  }
+  os << ']';
+}
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Insertion positions: "localized" drifts like an editor cursor, "random" jumps anywhere
+vector<size_t> MakePositions(size_t initial, size_t inserts, bool localized) {
+  mt19937 gen{ 2019 };
+  vector<size_t> positions;
+  positions.reserve(inserts);
+  size_t cursor = initial / 2;
+  for (size_t i = 0; i < inserts; i++) {
+    size_t size = initial + i;
+    if (localized) {
+      int step = uniform_int_distribution<int>(-8, 9)(gen); // mostly moves forward, as when typing
+      cursor = static_cast<size_t>(std::max<long long>(0, static_cast<long long>(cursor) + step));
+      cursor = std::min(cursor, size);
+      positions.push_back(cursor);
+      cursor++;
+    } else {
+      positions.push_back(uniform_int_distribution<size_t>(0, size)(gen));
+    }
+  }
+  return positions;
+}
+
+// Random insertions and erasures of strings (which a self-move would empty), checked against a
+// std::vector after every step; starting full, so the gap is often empty
+bool CheckAgainstVector() {
+  mt19937 gen{ 2019 };
+  GapBuffer<string> g{ "2", "7", "b", "6", "6", "6", "3", "3" };
+  vector<string> v{ "2", "7", "b", "6", "6", "6", "3", "3" };
+  for (int step = 0; step < 20'000; step++) {
+    size_t at = uniform_int_distribution<size_t>(0, v.size())(gen);
+    size_t count = uniform_int_distribution<size_t>(0, 3)(gen);
+    string value = to_string(step) + " is long enough not to fit in the small string buffer";
+    switch (v.empty() ? 0 : uniform_int_distribution<int>(0, 4)(gen)) {
+    case 0:
+      g.insert(begin(g) + at, value);
+      v.insert(begin(v) + at, value);
+      break;
+    case 1:
+      g.insert(begin(g) + at, count, value);
+      v.insert(begin(v) + at, count, value);
+      break;
+    case 2: {
+      vector<string> source(count, value);
+      g.insert(begin(g) + at, begin(source), end(source));
+      v.insert(begin(v) + at, begin(source), end(source));
+      break;
+    }
+    case 3:
+      at = std::min(at, v.size() - 1);
+      g.erase(begin(g) + at);
+      v.erase(begin(v) + at);
+      break;
+    default:
+      count = std::min(count, v.size() - at);
+      g.erase(begin(g) + at, begin(g) + at + count);
+      v.erase(begin(v) + at, begin(v) + at + count);
+      break;
+    }
+    if (vector<string>(begin(g), end(g)) != v) {
+      cout << " ERROR: GapBuffer<string> differs from std::vector<string> at step " << step << "! \n";
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Sequence, typename Value>
+double TimeInserts(Sequence& s, const vector<size_t>& positions, const Value& value) {
+  return TimeMs([&]() {
+    for (auto pos : positions) {
+      s.insert(begin(s) + pos, value);
+    }
+  });
+}
+
+struct Large { // a "large" element: expensive to shift around
+  array<int, 64> payload{};
+  bool operator==(const Large& other) const { return payload == other.payload; }
+};
+
+int main(int argc, char* argv[]) {
+  // usage: GapBufferInsert [initial elements] [inserts]
+  size_t initial = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+  size_t inserts = argc > 2 ? static_cast<size_t>(atoll(argv[2])) : 100'000;
+
+  // Same calls as `VecInsert.cpp`
+  GapBuffer<int> g{ 11, 22, 33, 44, 55, 66 };
+  PieceTable<int> t{ 11, 22, 33, 44, 55, 66 };
+  vector<int> source{ -11, -22, -33 };
+  g.insert(begin(g) + 1, 99);
+  g.insert(begin(g) + 2, 3, 100);
+  g.insert(begin(g) + 1, begin(source), end(source));
+  g.insert(begin(g) + 4, { 111, 222, 333 });
+  t.insert(begin(t) + 1, 99);
+  t.insert(begin(t) + 2, 3, 100);
+  t.insert(begin(t) + 1, begin(source), end(source));
+  t.insert(begin(t) + 4, { 111, 222, 333 });
+  cout << " GapBuffer:  "; Print(cout, g); cout << '\n';
+  cout << " PieceTable: "; Print(cout, t); cout << " (" << t.pieceCount() << " pieces) \n\n";
+
+  bool ok = CheckAgainstVector();
+  for (bool localized : { true, false }) {
+    auto positions = MakePositions(initial, inserts, localized);
+    cout << ' ' << inserts << (localized ? " localized" : " random") << " inserts into " << initial << " ints: \n";
+
+    vector<int> v(initial);
+    GapBuffer<int> gap;
+    gap.insert(begin(gap), initial, 0);
+    double vectorMs = TimeInserts(v, positions, 1);
+    double gapMs = TimeInserts(gap, positions, 1);
+    ok = ok && vector<int>(begin(gap), end(gap)) == v;
+    cout << "\tstd::vector::insert()  " << vectorMs << " ms \n";
+    cout << "\tGapBuffer::insert()    " << gapMs << " ms \n";
+
+    // Large elements: fewer of them, since every shift copies 256 bytes per element
+    size_t largeInitial = initial / 10;
+    size_t largeInserts = inserts / 10;
+    auto largePositions = MakePositions(largeInitial, largeInserts, localized);
+    Large value;
+    value.payload[0] = 1;
+    vector<Large> lv(largeInitial);
+    PieceTable<Large> pieces{ vector<Large>(largeInitial) };
+    double largeVectorMs = TimeInserts(lv, largePositions, value);
+    double pieceMs = TimeInserts(pieces, largePositions, value);
+    ok = ok && vector<Large>(begin(pieces), end(pieces)) == lv;
+    cout << "\t" << largeInserts << " inserts of 256-byte elements into " << largeInitial << ": \n";
+    cout << "\tstd::vector::insert()  " << largeVectorMs << " ms \n";
+    cout << "\tPieceTable::insert()   " << pieceMs << " ms (" << pieces.pieceCount() << " pieces) \n\n";
+  }
+
+  cout << (ok ? " All containers hold the same elements. \n" : " ERROR: containers differ! \n");
+  return ok ? 0 : 1;
+}
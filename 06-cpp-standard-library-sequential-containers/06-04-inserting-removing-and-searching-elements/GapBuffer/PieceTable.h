@@ -0,0 +1,207 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/*
+  Piece table: the variant of `GapBuffer` for large elements
+
+  Inserted elements are appended to an append-only `std::vector` (amortized O(1), as with
+  `push_back()`: it still moves its earlier elements when it reallocates), and an insertion never
+  shifts the elements after it; the sequence itself is a short list of "pieces" (ranges of the original or of the append buffer), so
+  an insertion only splits one piece. Consecutive insertions at a moving cursor extend the same
+  piece, so typing-like workloads keep the piece list short
+
+  The container offers the `std::vector` insertion API; the elements themselves are read-only
+*/
+template <typename T>
+class PieceTable
+{
+  struct Piece
+  {
+    bool added;        // in `appended` (true) or in `original` (false)
+    std::size_t start; // first element in that buffer
+    std::size_t length;
+  };
+
+public:
+  class const_iterator;
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = const_iterator;
+
+  PieceTable() = default;
+  PieceTable(std::initializer_list<T> init) : PieceTable(std::vector<T>(init)) {}
+  explicit PieceTable(std::vector<T> v) : original(std::move(v)) {
+    if (!original.empty()) {
+      pieces.push_back({ false, 0, original.size() });
+      ends.push_back(original.size());
+    }
+  }
+
+  size_type size() const { return ends.empty() ? 0 : ends.back(); }
+  bool empty() const { return size() == 0; }
+  size_type pieceCount() const { return pieces.size(); }
+
+  const T& operator[](size_type i) const {
+    size_type p = FindPiece(i);
+    return Element(p, i - PieceBegin(p));
+  }
+
+  const_iterator begin() const { return const_iterator(this, 0, 0); }
+  const_iterator end() const { return const_iterator(this, size(), pieces.size()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  void push_back(const T& value) { insert(end(), value); }
+
+  iterator insert(const_iterator pos, const T& value) { return insert(pos, size_type{ 1 }, value); }
+
+  iterator insert(const_iterator pos, size_type count, const T& value) {
+    T copy(value);
+    size_type first = appended.size();
+    appended.insert(appended.end(), count, copy);
+    return AddPiece(pos.index, first, count);
+  }
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type start = appended.size();
+    appended.insert(appended.end(), first, last);
+    return AddPiece(pos.index, start, appended.size() - start);
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<T> init) { return insert(pos, init.begin(), init.end()); }
+
+  iterator erase(const_iterator pos) {
+    size_type at = pos.index;
+    size_type p = FindPiece(at);
+    size_type offset = at - PieceBegin(p);
+    Piece& piece = pieces[p];
+    if (piece.length == 1) {
+      pieces.erase(pieces.begin() + p);
+      ends.erase(ends.begin() + p);
+    } else if (offset == 0) {
+      piece.start++;
+      piece.length--;
+    } else if (offset == piece.length - 1) {
+      piece.length--;
+    } else {
+      Piece tail{ piece.added, piece.start + offset + 1, piece.length - offset - 1 };
+      piece.length = offset;
+      pieces.insert(pieces.begin() + p + 1, tail);
+      ends.insert(ends.begin() + p + 1, 0);
+    }
+    UpdateEnds(p);
+    return Iterator(at);
+  }
+
+  class const_iterator
+  {
+    friend class PieceTable;
+
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator() = default;
+
+    reference operator*() const { return table->Element(piece, index - table->PieceBegin(piece)); }
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+      if (++index == table->ends[piece]) {
+        ++piece;
+      }
+      return *this;
+    }
+    const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+    const_iterator& operator--() {
+      if (index-- == table->PieceBegin(piece)) {
+        --piece;
+      }
+      return *this;
+    }
+    const_iterator operator--(int) { const_iterator old = *this; --*this; return old; }
+
+    // Jumps are O(log pieces), so `begin(t) + k` works as it does with `std::vector`
+    friend const_iterator operator+(const const_iterator& it, difference_type n) { return it.Jump(n); }
+    friend const_iterator operator-(const const_iterator& it, difference_type n) { return it.Jump(-n); }
+    friend difference_type operator-(const const_iterator& a, const const_iterator& b) {
+      return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+    }
+    friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.index == b.index; }
+    friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.index != b.index; }
+
+  private:
+    const_iterator(const PieceTable* t, size_type i, size_type p) : table(t), index(i), piece(p) {}
+    const_iterator Jump(difference_type n) const { return table->Iterator(index + n); }
+
+    const PieceTable* table = nullptr;
+    size_type index = 0; // logical position
+    size_type piece = 0; // piece containing `index` (== pieces.size() at the end)
+  };
+
+private:
+  size_type PieceBegin(size_type p) const { return p == 0 ? 0 : ends[p - 1]; }
+
+  // The piece containing logical position `i` (pieces.size() if `i` == size())
+  size_type FindPiece(size_type i) const {
+    return static_cast<size_type>(std::upper_bound(ends.begin(), ends.end(), i) - ends.begin());
+  }
+
+  const_iterator Iterator(size_type i) const { return const_iterator(this, i, FindPiece(i)); }
+
+  const T& Element(size_type p, size_type offset) const {
+    const Piece& piece = pieces[p];
+    return (piece.added ? appended : original)[piece.start + offset];
+  }
+
+  // Splices `count` elements appended at `appended[first]` into the sequence at logical position `at`
+  iterator AddPiece(size_type at, size_type first, size_type count) {
+    if (count == 0) {
+      return Iterator(at);
+    }
+    size_type p = FindPiece(at);
+    size_type offset = p < pieces.size() ? at - PieceBegin(p) : 0;
+
+    // Inserting right after the previous insertion (e.g., typing at a cursor): grow that piece
+    if (offset == 0 && p > 0 && pieces[p - 1].added && pieces[p - 1].start + pieces[p - 1].length == first) {
+      pieces[p - 1].length += count;
+      UpdateEnds(p - 1);
+      return Iterator(at);
+    }
+
+    Piece inserted{ true, first, count };
+    if (offset == 0) {
+      pieces.insert(pieces.begin() + p, inserted);
+      ends.insert(ends.begin() + p, 0);
+    } else { // split piece `p` around the insertion point
+      Piece tail{ pieces[p].added, pieces[p].start + offset, pieces[p].length - offset };
+      pieces[p].length = offset;
+      pieces.insert(pieces.begin() + p + 1, { inserted, tail });
+      ends.insert(ends.begin() + p + 1, 2, 0);
+    }
+    UpdateEnds(p);
+    return Iterator(at);
+  }
+
+  // Recomputes the cumulative piece ends from piece `p` onwards
+  void UpdateEnds(size_type p) {
+    for (size_type k = p; k < pieces.size(); k++) {
+      ends[k] = PieceBegin(k) + pieces[k].length;
+    }
+  }
+
+  std::vector<T> original;
+  std::vector<T> appended;
+  std::vector<Piece> pieces;
+  std::vector<size_type> ends; // ends[k] == total length of pieces[0..k]
+};
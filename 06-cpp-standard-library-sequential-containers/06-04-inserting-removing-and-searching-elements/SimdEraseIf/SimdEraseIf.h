@@ -0,0 +1,130 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+/*
+  Vectorized erase-remove ("stream compaction") for `std::vector<int>`
+
+  `SimdEraseIf(v, pred)` does the same as `v.erase(remove_if(begin(v), end(v), pred), end(v))`
+  (or C++20's `std::erase_if(v, pred)`), but when `pred` is one of the lane predicates below, it
+  evaluates the predicate on a whole register of elements at once and packs the survivors together:
+    * AVX-512: 16 elements per step, compressed with `vpcompressd`
+    * AVX2: 8 elements per step, compressed with `vpermd` and a 256-entry permutation table
+  Any other predicate (or element type) falls back to the scalar `std::remove_if()`
+*/
+
+// Tag base class: a predicate deriving from `LanePredicate` can also be evaluated on SIMD registers
+struct LanePredicate {};
+
+struct OddLanes : LanePredicate { // N.B. (x & 1) != 0, i.e., true for negative odd numbers too
+  bool operator()(int x) const { return (x & 1) != 0; }
+#if defined(__AVX2__)
+  __m256i operator()(__m256i x) const {
+    return _mm256_cmpeq_epi32(_mm256_and_si256(x, _mm256_set1_epi32(1)), _mm256_set1_epi32(1));
+  }
+#endif
+#if defined(__AVX512F__)
+  __mmask16 operator()(__m512i x) const { return _mm512_test_epi32_mask(x, _mm512_set1_epi32(1)); }
+#endif
+};
+
+struct EqualLanes : LanePredicate {
+  int value;
+  explicit EqualLanes(int v) : value(v) {}
+  bool operator()(int x) const { return x == value; }
+#if defined(__AVX2__)
+  __m256i operator()(__m256i x) const { return _mm256_cmpeq_epi32(x, _mm256_set1_epi32(value)); }
+#endif
+#if defined(__AVX512F__)
+  __mmask16 operator()(__m512i x) const { return _mm512_cmpeq_epi32_mask(x, _mm512_set1_epi32(value)); }
+#endif
+};
+
+struct LessLanes : LanePredicate {
+  int value;
+  explicit LessLanes(int v) : value(v) {}
+  bool operator()(int x) const { return x < value; }
+#if defined(__AVX2__)
+  __m256i operator()(__m256i x) const { return _mm256_cmpgt_epi32(_mm256_set1_epi32(value), x); }
+#endif
+#if defined(__AVX512F__)
+  __mmask16 operator()(__m512i x) const { return _mm512_cmplt_epi32_mask(x, _mm512_set1_epi32(value)); }
+#endif
+};
+
+struct GreaterLanes : LanePredicate {
+  int value;
+  explicit GreaterLanes(int v) : value(v) {}
+  bool operator()(int x) const { return x > value; }
+#if defined(__AVX2__)
+  __m256i operator()(__m256i x) const { return _mm256_cmpgt_epi32(x, _mm256_set1_epi32(value)); }
+#endif
+#if defined(__AVX512F__)
+  __mmask16 operator()(__m512i x) const { return _mm512_cmpgt_epi32_mask(x, _mm512_set1_epi32(value)); }
+#endif
+};
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+// For each 8-bit "keep" mask, the lane indices of the kept elements, packed to the front
+inline constexpr std::array<std::array<std::int32_t, 8>, 256> MakeCompressTable() {
+  std::array<std::array<std::int32_t, 8>, 256> table{};
+  for (int mask = 0; mask < 256; mask++) {
+    int out = 0;
+    for (int lane = 0; lane < 8; lane++) {
+      if (mask & (1 << lane)) {
+        table[mask][out++] = lane;
+      }
+    }
+  }
+  return table;
+}
+
+inline constexpr std::array<std::array<std::int32_t, 8>, 256> CompressTable = MakeCompressTable();
+#endif
+
+// Removes the elements for which `pred` is true; returns how many were removed
+template <typename T, typename Pred>
+std::size_t SimdEraseIf(std::vector<T>& v, Pred pred) {
+  const std::size_t oldSize = v.size();
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+  if constexpr (std::is_same_v<T, int> && sizeof(int) == 4 && std::is_base_of_v<LanePredicate, Pred>) {
+    int* data = v.data();
+    std::size_t in = 0;
+    std::size_t out = 0; // `out <= in` always, so a full-width store at `out` only overwrites already loaded elements
+#if defined(__AVX512F__)
+    for (; in + 16 <= oldSize; in += 16) {
+      __m512i x = _mm512_loadu_si512(data + in);
+      __mmask16 keep = static_cast<__mmask16>(~pred(x));
+      _mm512_mask_compressstoreu_epi32(data + out, keep, x);
+      out += static_cast<std::size_t>(__builtin_popcount(keep));
+    }
+#else
+    for (; in + 8 <= oldSize; in += 8) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + in));
+      unsigned keep = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(pred(x)))) & 0xFFu;
+      __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(CompressTable[keep].data()));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + out), _mm256_permutevar8x32_epi32(x, lanes));
+      out += static_cast<std::size_t>(__builtin_popcount(keep));
+    }
+#endif
+    for (; in < oldSize; in++) { // tail
+      if (!pred(data[in])) {
+        data[out++] = data[in];
+      }
+    }
+    v.resize(out);
+    return oldSize - out;
+  }
+#endif
+
+  v.erase(std::remove_if(begin(v), end(v), pred), end(v));
+  return oldSize - v.size();
+}
@@ -0,0 +1,88 @@
+// Demo: Vectorized erase-remove (stream compaction) vs. the erase-remove idiom
+
+#include <algorithm>
+using std::remove_if;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <ostream>
+using std::ostream;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <vector>
+using std::vector;
+
+#include "SimdEraseIf.h"
+
+
+ostream& operator<<(ostream& os, const vector<int>& v) {
+  os << "[ ";
+  for (const auto& x : v) {
+    os << x << ' ';
+  }
+  os << ']';
+  return os;
+}
+
+inline bool IsOdd(int x) { // predicate function from `EraseRemove.cpp`
+  return x % 2 == 1;
+}
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[]) {
+  // usage: SimdEraseRemove [elements]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 20'000'000;
+
+#if defined(__AVX512F__)
+  cout << " Kernel: AVX-512 (vpcompressd, 16 lanes) \n\n";
+#elif defined(__AVX2__)
+  cout << " Kernel: AVX2 (vpermd + permutation table, 8 lanes) \n\n";
+#else
+  cout << " Kernel: scalar std::remove_if() \n\n";
+#endif
+
+  vector<int> v{ 11, 22, 33, 44, 55, 66 };
+  cout << " Initial vector: " << v << '\n';
+  SimdEraseIf(v, OddLanes{});
+  cout << " After SimdEraseIf(v, OddLanes{}): " << v << "\n\n";
+
+  mt19937 gen{ 2019 };
+  uniform_int_distribution<int> dist(0, 1'000'000);
+  vector<int> data(count);
+  for (auto& x : data) {
+    x = dist(gen);
+  }
+
+  auto expected = data;
+  double idiomMs = TimeMs([&]() { expected.erase(remove_if(begin(expected), end(expected), IsOdd), end(expected)); });
+  auto simd = data;
+  double simdMs = TimeMs([&]() { SimdEraseIf(simd, OddLanes{}); });
+  cout << ' ' << count << " random ints, removing the odd ones (unpredictable branch): \n";
+  cout << "\terase(remove_if(...))        " << idiomMs << " ms \n";
+  cout << "\tSimdEraseIf(v, OddLanes{})   " << simdMs << " ms" << (simd == expected ? "" : " -- MISMATCH!") << '\n';
+  bool ok = simd == expected;
+
+  auto lambda = data; // an arbitrary predicate takes the scalar path
+  double lambdaMs = TimeMs([&]() { SimdEraseIf(lambda, [](int x) { return x < 100'000; }); });
+  simd = data;
+  simdMs = TimeMs([&]() { SimdEraseIf(simd, LessLanes{ 100'000 }); });
+  cout << " Removing values below 100000: \n";
+  cout << "\tlambda (scalar fallback)     " << lambdaMs << " ms \n";
+  cout << "\tLessLanes{ 100000 }          " << simdMs << " ms" << (simd == lambda ? "" : " -- MISMATCH!") << '\n';
+  ok = ok && simd == lambda;
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+/*
+  find / contains / count over small fixed-size arrays (e.g., look-up tables of 8-256 `int`s)
+
+  Since the element count `N` of a `std::array` (or a C-style array) is part of its type, the
+  whole search can be laid out at compile time: the array is compared in groups of up to 64
+  elements, each group with a fully unrolled sequence of SIMD compares whose results are packed
+  into one 64-bit match mask, so there is one branch per 64 elements rather than one per element
+    * AVX-512: 16 elements per compare, the last partial register via a masked load
+    * AVX2: 8 elements per compare, the last partial register via `vpmaskmovd`
+  Arrays of fewer than 8 elements, elements other than 32-bit integers, builds without AVX2, and
+  constant evaluation (e.g., inside a `static_assert`) all use a plain loop, so the same
+  functions are usable in `constexpr` code
+*/
+
+// C++20's `std::is_constant_evaluated()`, via the builtin that GCC and Clang also provide in C++17
+constexpr bool IsConstantEvaluated() {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_is_constant_evaluated();
+#else
+  return true; // can't tell: always take the constexpr-friendly path
+#endif
+}
+
+template <typename T>
+constexpr bool IsSimdSearchable = std::is_integral_v<T> && sizeof(T) == 4;
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+// Bit i is set iff p[i] == value, for the first `Count` (at most 64) elements
+template <std::size_t Count, typename T>
+std::uint64_t MatchMask(const T* p, T value) {
+  static_assert(Count > 0 && Count <= 64);
+  std::uint64_t mask = 0;
+#if defined(__AVX512F__)
+  const __m512i needle = _mm512_set1_epi32(static_cast<std::int32_t>(value));
+  for (std::size_t i = 0; i < Count; i += 16) { // constant trip count: fully unrolled
+    const __mmask16 lanes = Count - i >= 16 ? 0xFFFF : static_cast<__mmask16>((1u << (Count - i)) - 1);
+    __m512i x = _mm512_maskz_loadu_epi32(lanes, p + i); // lanes past the end aren't read
+    mask |= std::uint64_t{ _mm512_mask_cmpeq_epi32_mask(lanes, x, needle) } << i;
+  }
+#else
+  const __m256i needle = _mm256_set1_epi32(static_cast<std::int32_t>(value));
+  for (std::size_t i = 0; i < Count; i += 8) {
+    __m256i x;
+    unsigned lanes = 0xFF;
+    if (Count - i >= 8) {
+      x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    } else {
+      lanes = (1u << (Count - i)) - 1;
+      const __m256i load = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(Count - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      x = _mm256_maskload_epi32(reinterpret_cast<const int*>(p + i), load); // lanes past the end aren't read
+    }
+    unsigned bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, needle))));
+    mask |= std::uint64_t{ bits & lanes } << i;
+  }
+#endif
+  return mask;
+}
+#endif
+
+// Index of the first element equal to `value` among p[0], ..., p[N - 1], or `N` if there is none
+template <std::size_t N, typename T>
+constexpr std::size_t FixedFindIndex(const T* p, const T& value) {
+#if defined(__AVX2__) || defined(__AVX512F__)
+  if constexpr (IsSimdSearchable<T> && N >= 8) {
+    if (!IsConstantEvaluated()) {
+      std::size_t g = 0;
+      for (; g + 64 <= N; g += 64) {
+        if (std::uint64_t mask = MatchMask<64>(p + g, value)) {
+          return g + static_cast<std::size_t>(__builtin_ctzll(mask));
+        }
+      }
+      if constexpr (N % 64 != 0) {
+        if (std::uint64_t mask = MatchMask<N % 64>(p + g, value)) {
+          return g + static_cast<std::size_t>(__builtin_ctzll(mask));
+        }
+      }
+      return N;
+    }
+  }
+#endif
+  for (std::size_t i = 0; i < N; i++) {
+    if (p[i] == value) {
+      return i;
+    }
+  }
+  return N;
+}
+
+// Number of elements equal to `value` among p[0], ..., p[N - 1]
+template <std::size_t N, typename T>
+constexpr std::size_t FixedCount(const T* p, const T& value) {
+#if defined(__AVX2__) || defined(__AVX512F__)
+  if constexpr (IsSimdSearchable<T> && N >= 8) {
+    if (!IsConstantEvaluated()) {
+      std::size_t count = 0;
+      std::size_t g = 0;
+      for (; g + 64 <= N; g += 64) {
+        count += static_cast<std::size_t>(__builtin_popcountll(MatchMask<64>(p + g, value)));
+      }
+      if constexpr (N % 64 != 0) {
+        count += static_cast<std::size_t>(__builtin_popcountll(MatchMask<N % 64>(p + g, value)));
+      }
+      return count;
+    }
+  }
+#endif
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < N; i++) {
+    count += p[i] == value ? 1 : 0;
+  }
+  return count;
+}
+
+// Same as `std::find(begin(a), end(a), value)`
+template <typename T, std::size_t N>
+constexpr typename std::array<T, N>::const_iterator ArrayFind(const std::array<T, N>& a, const T& value) {
+  return a.begin() + FixedFindIndex<N>(a.data(), value);
+}
+
+template <typename T, std::size_t N>
+constexpr typename std::array<T, N>::iterator ArrayFind(std::array<T, N>& a, const T& value) {
+  return a.begin() + FixedFindIndex<N>(a.data(), value);
+}
+
+template <typename T, std::size_t N>
+constexpr const T* ArrayFind(const T (&a)[N], const T& value) {
+  return a + FixedFindIndex<N>(a, value);
+}
+
+// Same as `std::find(begin(a), end(a), value) != end(a)`
+template <typename T, std::size_t N>
+constexpr bool ArrayContains(const std::array<T, N>& a, const T& value) {
+  return FixedFindIndex<N>(a.data(), value) != N;
+}
+
+template <typename T, std::size_t N>
+constexpr bool ArrayContains(const T (&a)[N], const T& value) {
+  return FixedFindIndex<N>(a, value) != N;
+}
+
+// Same as `std::count(begin(a), end(a), value)`
+template <typename T, std::size_t N>
+constexpr std::size_t ArrayCount(const std::array<T, N>& a, const T& value) {
+  return FixedCount<N>(a.data(), value);
+}
+
+template <typename T, std::size_t N>
+constexpr std::size_t ArrayCount(const T (&a)[N], const T& value) {
+  return FixedCount<N>(a, value);
+}
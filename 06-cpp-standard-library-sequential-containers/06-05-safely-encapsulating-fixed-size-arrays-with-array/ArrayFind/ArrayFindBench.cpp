@@ -0,0 +1,123 @@
+// Demo: find / contains / count over small std::arrays with compile-time size dispatch vs. std::find / std::count
+
+#include <algorithm>
+using std::count;
+using std::find;
+using std::shuffle;
+#include <array>
+using std::array;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <iterator>
+using std::begin;
+using std::end;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <vector>
+using std::vector;
+
+#include "ArrayFind.h"
+
+
+// Same table as `Array.cpp`; the searches below run entirely at compile time
+static constexpr array<int, 6> table{ 11, 22, 33, 44, 55, 66 };
+static_assert(ArrayContains(table, 44) && !ArrayContains(table, 45));
+static_assert(ArrayFind(table, 55) - table.begin() == 4);
+
+static constexpr array<int, 16> squares{ 0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225 };
+static_assert(ArrayFind(squares, 144) - squares.begin() == 12 && ArrayCount(squares, 7) == 0);
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Searches an array of N ints for each of `queries` (half of them hits)
+template <size_t N>
+bool Bench(size_t queries, mt19937& gen) {
+  uniform_int_distribution<int> dist(0, 1'000'000);
+  array<int, N> a{};
+  for (auto& x : a) {
+    x = dist(gen) % 4096; // a few duplicates, for count()
+  }
+  vector<int> values(queries);
+  for (size_t i = 0; i < queries; i++) {
+    values[i] = i % 2 == 0 ? a[static_cast<size_t>(dist(gen)) % N] : dist(gen) % 4096;
+  }
+
+  size_t stdFound = 0;
+  size_t stdCounted = 0;
+  size_t found = 0;
+  size_t contained = 0;
+  size_t counted = 0;
+  double stdFindMs = TimeMs([&]() {
+    for (int v : values) {
+      stdFound += static_cast<size_t>(find(begin(a), end(a), v) - begin(a));
+    }
+  });
+  double findMs = TimeMs([&]() {
+    for (int v : values) {
+      found += static_cast<size_t>(ArrayFind(a, v) - begin(a));
+    }
+  });
+  double containsMs = TimeMs([&]() {
+    for (int v : values) {
+      contained += ArrayContains(a, v) ? 1 : 0;
+    }
+  });
+  double stdCountMs = TimeMs([&]() {
+    for (int v : values) {
+      stdCounted += static_cast<size_t>(count(begin(a), end(a), v));
+    }
+  });
+  double countMs = TimeMs([&]() {
+    for (int v : values) {
+      counted += ArrayCount(a, v);
+    }
+  });
+
+  size_t stdContained = 0;
+  for (int v : values) {
+    stdContained += find(begin(a), end(a), v) != end(a) ? 1 : 0;
+  }
+  bool ok = found == stdFound && contained == stdContained && counted == stdCounted;
+  cout << "\tN = " << N << ":\tstd::find " << stdFindMs << " ms, ArrayFind " << findMs << " ms, ArrayContains "
+       << containsMs << " ms; std::count " << stdCountMs << " ms, ArrayCount " << countMs << " ms"
+       << (ok ? "" : " -- MISMATCH!") << '\n';
+  return ok;
+}
+
+int main(int argc, char* argv[]) {
+  // usage: ArrayFindBench [queries per size]
+  size_t queries = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  cout << " std::array's elements: \n";
+  for (const auto& x : table) {
+    cout << ' ' << x;
+  }
+  cout << "\n 44 " << (ArrayContains(table, 44) ? "was found" : "not found") << " in the array (checked at compile time). \n\n";
+
+  cout << ' ' << queries << " searches per array size: \n";
+  mt19937 gen{ 1846 };
+  bool ok = true;
+  ok = Bench<8>(queries, gen) && ok;
+  ok = Bench<13>(queries, gen) && ok;
+  ok = Bench<16>(queries, gen) && ok;
+  ok = Bench<32>(queries, gen) && ok;
+  ok = Bench<64>(queries, gen) && ok;
+  ok = Bench<100>(queries, gen) && ok;
+  ok = Bench<128>(queries, gen) && ok;
+  ok = Bench<256>(queries, gen) && ok;
+
+  return ok ? 0 : 1;
+}
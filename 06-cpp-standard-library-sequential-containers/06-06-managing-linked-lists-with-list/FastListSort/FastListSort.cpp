@@ -0,0 +1,78 @@
+// Demo: Sorting std::list via a contiguous array of cached keys vs. std::list::sort()
+
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <list>
+using std::list;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+using std::to_string;
+#include <vector>
+using std::vector;
+
+#include "ListSorting.h"
+
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+template <typename T>
+bool Compare(const char* what, size_t count, const list<T>& original) {
+  auto a = original;
+  auto b = original;
+  double listMs = TimeMs([&]() { a.sort(); });
+  double keyedMs = TimeMs([&]() { SortList(b); });
+  cout << '\t' << what << " x " << count << ": list::sort() " << listMs << " ms, SortList() " << keyedMs
+       << " ms (speedup " << listMs / keyedMs << "x)" << (a == b ? "" : " -- MISMATCH!") << '\n';
+  return a == b;
+}
+
+int main(int argc, char* argv[]) {
+  // usage: FastListSort [largest size] -- sizes from 10^5 up to the largest (default 10^6; try 10000000)
+  size_t largest = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  // Same list as `ListSort.cpp`
+  list<string> planets{
+    "Mercury", "Venus", "Earth",
+    "Mars", "Jupiter", "Saturn",
+    "Uranus", "Neptune"
+  };
+  SortList(planets);
+  cout << " Sorted list of planets (alphabetical order): \n";
+  for (auto const& name : planets) {
+    cout << ' ' << name;
+  }
+  cout << "\n\n";
+
+  const vector<string> names{ "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune" };
+  mt19937 gen{ 1846 };
+  bool ok = true;
+  for (size_t count = 100'000; count <= largest; count *= 10) {
+    uniform_int_distribution<int> dist(0, 1'000'000'000);
+    uniform_int_distribution<size_t> pick(0, names.size() - 1);
+    list<int> ints;
+    list<string> strings;
+    for (size_t i = 0; i < count; i++) {
+      ints.push_back(dist(gen));
+      strings.push_back(names[pick(gen)] + " #" + to_string(dist(gen)));
+    }
+    ok = Compare("int   ", count, ints) && ok;
+    ok = Compare("string", count, strings) && ok;
+  }
+
+  return ok ? 0 : 1;
+}
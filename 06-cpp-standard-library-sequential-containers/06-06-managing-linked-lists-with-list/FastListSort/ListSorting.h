@@ -0,0 +1,105 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+  Sorting a `std::list` without the pointer chasing of `std::list::sort()`
+
+  `list::sort()` is a merge sort that walks and relinks the nodes over and over; each step of
+  each pass follows a `next` pointer to a node that is usually not in cache. Instead:
+    1. gather one (cached key, iterator) entry per node into a contiguous array
+    2. sort that array -- most comparisons only look at the cached keys
+    3. relink the nodes in sorted order in one pass, via `splice()` (no element is copied or
+       moved, and iterators/references to the elements stay valid, as with `list::sort()`)
+  All sorts here are stable, like `list::sort()`
+*/
+
+// Relinks the nodes of `l` in the order of `entries[i].it`
+template <typename List, typename Entry>
+void RelinkInOrder(List& l, const std::vector<Entry>& entries) {
+  for (const auto& e : entries) {
+    l.splice(l.end(), l, e.it); // moves the node to the back: O(1), no element copies
+  }
+}
+
+// Sorts by `keyOf(element)`; the keys must be cheap to copy and totally ordered by `<`
+template <typename T, typename Alloc, typename KeyOf>
+void SortListByKey(std::list<T, Alloc>& l, KeyOf keyOf) {
+  using Key = std::decay_t<decltype(keyOf(l.front()))>;
+  struct Entry
+  {
+    Key key;
+    typename std::list<T, Alloc>::iterator it;
+  };
+  std::vector<Entry> entries;
+  entries.reserve(l.size());
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    entries.push_back({ keyOf(*it), it });
+  }
+  std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+  RelinkInOrder(l, entries);
+}
+
+// 8 characters of `s` starting at `offset`, big-endian, zero padded: comparing these as integers
+// gives the same order as comparing the strings, up to ties
+inline std::uint64_t StringPrefixKey(const std::string& s, std::size_t offset = 0) {
+  std::uint64_t key = 0;
+  for (std::size_t i = offset; i < offset + 8; i++) {
+    key = (key << 8) | (i < s.size() ? static_cast<unsigned char>(s[i]) : 0u);
+  }
+  return key;
+}
+
+// Sorts with an arbitrary comparison; the array of iterators is still contiguous, but
+// each comparison dereferences two nodes
+template <typename T, typename Alloc, typename Compare>
+void SortList(std::list<T, Alloc>& l, Compare comp) {
+  struct Entry
+  {
+    typename std::list<T, Alloc>::iterator it;
+  };
+  std::vector<Entry> entries;
+  entries.reserve(l.size());
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    entries.push_back({ it });
+  }
+  std::stable_sort(entries.begin(), entries.end(), [&comp](const Entry& a, const Entry& b) { return comp(*a.it, *b.it); });
+  RelinkInOrder(l, entries);
+}
+
+// Same result as `l.sort()` (ascending by `operator<`, stable)
+template <typename T, typename Alloc>
+void SortList(std::list<T, Alloc>& l) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    SortListByKey(l, [](const T& x) { return x; }); // the element itself is the cached key
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    struct Entry
+    {
+      std::uint64_t prefix[2]; // first 16 characters
+      typename std::list<T, Alloc>::iterator it;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(l.size());
+    for (auto it = l.begin(); it != l.end(); ++it) {
+      entries.push_back({ { StringPrefixKey(*it), StringPrefixKey(*it, 8) }, it });
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+      if (a.prefix[0] != b.prefix[0]) {
+        return a.prefix[0] < b.prefix[0];
+      }
+      if (a.prefix[1] != b.prefix[1]) {
+        return a.prefix[1] < b.prefix[1];
+      }
+      return *a.it < *b.it; // equal prefixes: only now look at the strings
+    });
+    RelinkInOrder(l, entries);
+  } else {
+    SortList(l, std::less<>{});
+  }
+}
@@ -0,0 +1,177 @@
+// Demo: Node containers with the default allocator vs. a slab pool and std::pmr resources
+
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdint>
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <list>
+using std::list;
+#include <map>
+using std::map;
+#include <memory_resource>
+using std::pmr::monotonic_buffer_resource;
+using std::pmr::unsynchronized_pool_resource;
+using std::pmr::polymorphic_allocator;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <set>
+using std::set;
+#include <string>
+using std::string;
+using std::to_string;
+#include <vector>
+using std::vector;
+#if defined(__unix__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "PoolAllocator.h"
+
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+long PeakRssKiB() {
+#if defined(__unix__)
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss; // KiB on Linux
+#else
+  return -1;
+#endif
+}
+
+// Insert / iterate / sort a list of planet-like names, then insert / iterate a set and a map
+template <typename List, typename Set, typename Map>
+void Run(const char* name, const vector<string>& names, List planets, Set ids, Map catalog) {
+  double insertMs = TimeMs([&]() {
+    for (const auto& s : names) {
+      planets.push_back(s);
+    }
+  });
+  size_t totalLength = 0;
+  double iterateMs = TimeMs([&]() {
+    for (const auto& s : planets) {
+      totalLength += s.size();
+    }
+  });
+  double sortMs = TimeMs([&]() { planets.sort(); });
+
+  double setMapMs = TimeMs([&]() {
+    int id = 0;
+    for (const auto& s : names) {
+      ids.insert(id * 7919 % static_cast<int>(names.size()));
+      catalog.emplace(id++, s.size());
+    }
+    for (int x : ids) {
+      totalLength += x & 1;
+    }
+    for (const auto& entry : catalog) {
+      totalLength += entry.second;
+    }
+  });
+
+  cout << ' ' << name << "\n\tlist: insert " << insertMs << " ms, iterate " << iterateMs << " ms, sort " << sortMs
+       << " ms; set+map: " << setMapMs << " ms; peak RSS " << PeakRssKiB() << " KiB (checksum " << totalLength << ")\n";
+}
+
+void RunVariant(int variant, const vector<string>& names) {
+  switch (variant) {
+  case 0:
+    Run("default allocator (global new per node)", names, list<string>{}, set<int>{}, map<int, size_t>{});
+    break;
+  case 1: {
+    SlabArena arena;
+    Run("PoolAllocator (slab arena)", names,
+      list<string, PoolAllocator<string>>{ PoolAllocator<string>{ arena } },
+      set<int, std::less<int>, PoolAllocator<int>>{ PoolAllocator<int>{ arena } },
+      map<int, size_t, std::less<int>, PoolAllocator<std::pair<const int, size_t>>>{ PoolAllocator<std::pair<const int, size_t>>{ arena } });
+    break;
+  }
+  case 2: {
+    unsynchronized_pool_resource pool;
+    Run("std::pmr::unsynchronized_pool_resource", names,
+      std::pmr::list<string>{ &pool }, std::pmr::set<int>{ &pool }, std::pmr::map<int, size_t>{ &pool });
+    break;
+  }
+  case 3: {
+    monotonic_buffer_resource buffer; // never reuses freed memory: fastest when everything is released at once
+    Run("std::pmr::monotonic_buffer_resource", names,
+      std::pmr::list<string>{ &buffer }, std::pmr::set<int>{ &buffer }, std::pmr::map<int, size_t>{ &buffer });
+    break;
+  }
+  }
+}
+
+// A node type aligned more strictly than `operator new` guarantees is allocated outside the pool
+struct alignas(64) CacheLineValue {
+  int value;
+};
+
+bool CheckOverAligned() {
+  SlabArena arena;
+  list<CacheLineValue, PoolAllocator<CacheLineValue>> values{ PoolAllocator<CacheLineValue>{ arena } };
+  for (int i = 0; i < 100; i++) {
+    values.push_back({ i });
+  }
+  for (const auto& x : values) {
+    if (reinterpret_cast<std::uintptr_t>(&x) % alignof(CacheLineValue) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // usage: ListPool [elements]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  const vector<string> planets{ "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune" };
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<size_t> pick(0, planets.size() - 1);
+  vector<string> names;
+  names.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    names.push_back(planets[pick(gen)] + '-' + to_string(i % 1000)); // short enough for the small string optimization
+  }
+  if (!CheckOverAligned()) {
+    cout << " ERROR: PoolAllocator returned under-aligned memory! \n";
+    return 1;
+  }
+  cout << ' ' << count << " elements \n\n";
+
+  const int variants = 4;
+#if defined(__unix__)
+  // Each variant runs in its own child process, so its peak RSS isn't inflated by the previous ones
+  for (int variant = 0; variant < variants; variant++) {
+    cout.flush();
+    pid_t child = fork();
+    if (child == 0) {
+      RunVariant(variant, names);
+      cout.flush();
+      _exit(0);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+  }
+#else
+  for (int variant = 0; variant < variants; variant++) {
+    RunVariant(variant, names);
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/*
+  Slab ("pool") allocation for node-based containers
+
+  `std::list`, `std::set` and `std::map` allocate every node separately with the global `new`,
+  which scatters the nodes across the heap. `SlabArena` carves nodes out of large slabs instead:
+  nodes allocated one after another are adjacent in memory (better for iteration), and freed
+  nodes go to a free list for their size class, to be reused by the next allocation of that size
+
+  `PoolAllocator<T>` is a standard allocator that draws single-node allocations from an arena:
+    SlabArena arena;
+    std::list<std::string, PoolAllocator<std::string>> planets{ PoolAllocator<std::string>{ arena } };
+  (The standard library's `std::pmr` resources, such as `std::pmr::unsynchronized_pool_resource`,
+  are the ready-made alternative; cf. `ListPool.cpp`)
+
+  N.B. Not thread-safe; the arena must outlive every container using it
+*/
+class SlabArena
+{
+public:
+  static constexpr std::size_t Granularity = 16;  // size classes: 16, 32, ..., MaxPooledSize bytes
+  static constexpr std::size_t MaxPooledSize = 256;
+
+  explicit SlabArena(std::size_t slabBytes = 64 * 1024) : slabSize(slabBytes) {}
+  SlabArena(const SlabArena&) = delete;
+  SlabArena& operator=(const SlabArena&) = delete;
+  ~SlabArena() {
+    for (void* slab : slabs) {
+      ::operator delete(slab);
+    }
+  }
+
+  void* Allocate(std::size_t bytes) {
+    std::size_t sizeClass = SizeClass(bytes);
+    if (FreeNode* node = freeLists[sizeClass]) { // reuse a freed node of the same size class
+      freeLists[sizeClass] = node->next;
+      return node;
+    }
+    std::size_t rounded = (sizeClass + 1) * Granularity;
+    if (static_cast<std::size_t>(limit - cursor) < rounded) {
+      cursor = static_cast<char*>(::operator new(slabSize));
+      limit = cursor + slabSize;
+      slabs.push_back(cursor);
+    }
+    void* p = cursor;
+    cursor += rounded;
+    return p;
+  }
+
+  void Deallocate(void* p, std::size_t bytes) {
+    std::size_t sizeClass = SizeClass(bytes);
+    freeLists[sizeClass] = new (p) FreeNode{ freeLists[sizeClass] };
+  }
+
+  std::size_t BytesReserved() const { return slabs.size() * slabSize; }
+
+private:
+  struct FreeNode
+  {
+    FreeNode* next;
+  };
+
+  static std::size_t SizeClass(std::size_t bytes) { return (bytes + Granularity - 1) / Granularity - 1; }
+
+  std::size_t slabSize;
+  std::vector<void*> slabs;
+  char* cursor = nullptr;
+  char* limit = nullptr;
+  FreeNode* freeLists[MaxPooledSize / Granularity] = {};
+};
+
+template <typename T>
+class PoolAllocator
+{
+public:
+  using value_type = T;
+
+  explicit PoolAllocator(SlabArena& a) noexcept : arena(&a) {}
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept : arena(other.arena) {} // rebind (e.g., to the list's node type)
+
+  T* allocate(std::size_t n) {
+    if (n == 1 && Pooled()) {
+      return static_cast<T*>(arena->Allocate(sizeof(T)));
+    }
+    if constexpr (OverAligned()) { // the plain `operator new` only guarantees the default alignment
+      return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ alignof(T) }));
+    } else {
+      return static_cast<T*>(::operator new(n * sizeof(T))); // arrays (e.g., hash buckets) and large nodes
+    }
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (n == 1 && Pooled()) {
+      arena->Deallocate(p, sizeof(T));
+    } else if constexpr (OverAligned()) {
+      ::operator delete(p, std::align_val_t{ alignof(T) });
+    } else {
+      ::operator delete(p);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& other) const noexcept { return arena == other.arena; }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>& other) const noexcept { return arena != other.arena; }
+
+private:
+  template <typename U>
+  friend class PoolAllocator;
+
+  static constexpr bool Pooled() {
+    return sizeof(T) <= SlabArena::MaxPooledSize && alignof(T) <= SlabArena::Granularity;
+  }
+
+  static constexpr bool OverAligned() { return alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__; }
+
+  SlabArena* arena;
+};
@@ -0,0 +1,442 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+  Unrolled linked list: a doubly linked list of blocks, each holding up to `BlockSize` elements
+  stored contiguously
+
+  Compared with `std::list` (one heap node per element):
+    * iteration walks contiguous arrays, so it touches far fewer cache lines and pointers
+    * inserting or erasing at an iterator only shifts elements inside one block (at most
+      `BlockSize`, i.e., O(1)); a full block is split in two, and erasing keeps a block at least a
+      quarter full (unless it's the only one) by merging it with a neighbor or taking some of the
+      neighbor's elements
+    * `sort()` sorts each block in place, then merges runs of blocks; `merge()` and `splice()` also
+      work on whole blocks, not on single nodes
+
+  N.B. Unlike `std::list`, inserting or erasing invalidates iterators into the affected block(s)
+*/
+template <typename T, std::size_t BlockSize = 32>
+class UnrolledList
+{
+  static_assert(BlockSize >= 4, "blocks must hold a few elements");
+
+  struct Block
+  {
+    Block* prev = nullptr;
+    Block* next = nullptr;
+    std::size_t count = 0;
+    alignas(T) unsigned char storage[BlockSize * sizeof(T)];
+
+    T* data() { return std::launder(reinterpret_cast<T*>(storage)); }
+    T& operator[](std::size_t i) { return data()[i]; }
+  };
+
+  template <bool IsConst>
+  class Iterator;
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  UnrolledList() = default;
+  UnrolledList(std::initializer_list<T> init) {
+    for (const auto& x : init) {
+      push_back(x);
+    }
+  }
+  UnrolledList(const UnrolledList& other) {
+    for (const auto& x : other) {
+      push_back(x);
+    }
+  }
+  UnrolledList(UnrolledList&& other) noexcept { Swap(other); }
+  UnrolledList& operator=(UnrolledList other) noexcept {
+    Swap(other);
+    return *this;
+  }
+  ~UnrolledList() { clear(); }
+
+  size_type size() const { return count; }
+  bool empty() const { return count == 0; }
+  size_type blockCount() const { return blocks; }
+
+  iterator begin() { return iterator(this, head, 0); }
+  iterator end() { return iterator(this, nullptr, 0); }
+  const_iterator begin() const { return const_iterator(this, head, 0); }
+  const_iterator end() const { return const_iterator(this, nullptr, 0); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  T& front() { return (*head)[0]; }
+  T& back() { return (*tail)[tail->count - 1]; }
+
+  void push_back(const T& value) { insert(end(), value); }
+  void push_back(T&& value) { insert(end(), std::move(value)); }
+  void push_front(const T& value) { insert(begin(), value); }
+  void push_front(T&& value) { insert(begin(), std::move(value)); }
+
+  iterator insert(const_iterator pos, const T& value) {
+    T copy(value); // `value` may refer to an element that the insertion shifts
+    return Emplace(pos, std::move(copy));
+  }
+  iterator insert(const_iterator pos, T&& value) { return Emplace(pos, std::move(value)); }
+
+  iterator erase(const_iterator pos) {
+    Block* b = pos.block;
+    std::size_t i = pos.index;
+    std::move(b->data() + i + 1, b->data() + b->count, b->data() + i);
+    b->data()[b->count - 1].~T();
+    b->count--;
+    count--;
+
+    if (b->count == 0) {
+      Block* next = b->next;
+      Unlink(b);
+      return iterator(this, next, 0);
+    }
+    if (b->count < BlockSize / 4 && (b->prev || b->next)) {
+      // merge the sparse block with a neighbor if that leaves room to insert, otherwise even them out
+      Block* left = b->next ? b : b->prev;
+      i += left == b ? 0 : left->count; // the position in `left`, then `left->next`
+      if (left->count + left->next->count <= BlockSize * 3 / 4) {
+        MergeIntoPrevious(left->next);
+      } else {
+        Rebalance(left);
+      }
+      b = left;
+      if (i >= b->count) {
+        i -= b->count;
+        b = b->next;
+      }
+    }
+    if (b && i == b->count) {
+      return iterator(this, b->next, 0);
+    }
+    return iterator(this, b, i);
+  }
+
+  void clear() {
+    while (head) {
+      Block* b = head;
+      head = b->next;
+      std::destroy(b->data(), b->data() + b->count);
+      delete b;
+    }
+    tail = nullptr;
+    count = 0;
+    blocks = 0;
+  }
+
+  // Moves all elements of `other` in front of `pos`; only the block containing `pos` is touched
+  void splice(const_iterator pos, UnrolledList& other) {
+    if (&other == this || other.empty()) {
+      return;
+    }
+    Block* before = nullptr; // the new blocks go between `before` and `after`
+    Block* after = nullptr;
+    if (pos.block == nullptr) {
+      before = tail;
+    } else if (pos.index == 0) {
+      before = pos.block->prev;
+      after = pos.block;
+    } else {
+      SplitBlock(pos.block, pos.index);
+      before = pos.block;
+      after = pos.block->next;
+    }
+    other.head->prev = before;
+    other.tail->next = after;
+    (before ? before->next : head) = other.head;
+    (after ? after->prev : tail) = other.tail;
+    count += other.count;
+    blocks += other.blocks;
+    other.head = other.tail = nullptr;
+    other.count = other.blocks = 0;
+  }
+
+  // Merges the sorted `other` into this sorted list (stable; `other` ends up empty)
+  template <typename Compare = std::less<>>
+  void merge(UnrolledList& other, Compare comp = Compare{}) {
+    if (&other == this || other.empty()) {
+      return;
+    }
+    size_type total = count + other.count;
+    Chain merged = MergeChains({ head, tail }, { other.head, other.tail }, comp);
+    other.head = other.tail = nullptr;
+    other.count = other.blocks = 0;
+    Adopt(merged, total);
+  }
+
+  // Stable sort: each block is sorted in place, then runs of blocks are merged bottom-up
+  template <typename Compare = std::less<>>
+  void sort(Compare comp = Compare{}) {
+    if (count < 2) {
+      return;
+    }
+    std::vector<Chain> runs;
+    for (Block* b = head; b;) {
+      Block* next = b->next;
+      std::stable_sort(b->data(), b->data() + b->count, comp);
+      b->prev = b->next = nullptr;
+      runs.push_back({ b, b });
+      b = next;
+    }
+    while (runs.size() > 1) {
+      std::vector<Chain> merged;
+      for (std::size_t i = 0; i + 1 < runs.size(); i += 2) {
+        merged.push_back(MergeChains(runs[i], runs[i + 1], comp));
+      }
+      if (runs.size() % 2 == 1) {
+        merged.push_back(runs.back());
+      }
+      runs.swap(merged);
+    }
+    Adopt(runs.front(), count);
+  }
+
+private:
+  struct Chain
+  {
+    Block* first;
+    Block* last;
+  };
+
+  template <typename U>
+  iterator Emplace(const_iterator pos, U&& value) {
+    Block* b = pos.block;
+    std::size_t i = pos.index;
+    if (b == nullptr) { // at the end: append to the last block, or start a new one
+      b = tail;
+      if (b == nullptr || b->count == BlockSize) {
+        b = LinkAfter(tail);
+      }
+      i = b->count;
+    } else if (i == 0 && b->prev && b->prev->count < BlockSize) {
+      b = b->prev; // in front of a block: use the room at the end of the previous block
+      i = b->count;
+    } else if (b->count == BlockSize) {
+      SplitBlock(b, BlockSize / 2);
+      if (i > BlockSize / 2) {
+        i -= BlockSize / 2;
+        b = b->next;
+      }
+    }
+
+    // shift the tail of the block (at most `BlockSize` elements) one slot to the right
+    T* d = b->data();
+    if (i == b->count) {
+      new (d + i) T(std::forward<U>(value));
+    } else {
+      new (d + b->count) T(std::move(d[b->count - 1]));
+      std::move_backward(d + i, d + b->count - 1, d + b->count);
+      d[i] = std::forward<U>(value);
+    }
+    b->count++;
+    count++;
+    return iterator(this, b, i);
+  }
+
+  // Moves the elements from index `at` onwards into a new block after `b`
+  void SplitBlock(Block* b, std::size_t at) {
+    Block* right = LinkAfter(b);
+    std::uninitialized_move(b->data() + at, b->data() + b->count, right->data());
+    std::destroy(b->data() + at, b->data() + b->count);
+    right->count = b->count - at;
+    b->count = at;
+  }
+
+  void MergeIntoPrevious(Block* b) {
+    Block* left = b->prev;
+    std::uninitialized_move(b->data(), b->data() + b->count, left->data() + left->count);
+    std::destroy(b->data(), b->data() + b->count);
+    left->count += b->count;
+    b->count = 0;
+    Unlink(b);
+  }
+
+  // Splits the elements of `left` and `left->next` evenly between them (each then holds more than
+  // 3/8 of a block, as this is only called when they hold more than 3/4 of a block together)
+  void Rebalance(Block* left) {
+    Block* right = left->next;
+    std::size_t target = (left->count + right->count) / 2;
+    T* l = left->data();
+    T* r = right->data();
+    if (left->count > target) { // the tail of `left` goes to the front of `right`
+      std::size_t k = left->count - target;
+      for (std::size_t j = right->count; j-- > 0;) {
+        if (j + k >= right->count) {
+          new (r + j + k) T(std::move(r[j]));
+        } else {
+          r[j + k] = std::move(r[j]);
+        }
+      }
+      std::destroy(r, r + std::min(k, right->count));
+      std::uninitialized_move(l + target, l + left->count, r);
+      std::destroy(l + target, l + left->count);
+      left->count = target;
+      right->count += k;
+    } else if (left->count < target) { // the front of `right` goes to the tail of `left`
+      std::size_t k = target - left->count;
+      std::uninitialized_move(r, r + k, l + left->count);
+      std::move(r + k, r + right->count, r);
+      std::destroy(r + right->count - k, r + right->count);
+      left->count = target;
+      right->count -= k;
+    }
+  }
+
+  Block* LinkAfter(Block* b) {
+    Block* n = new Block;
+    n->prev = b;
+    n->next = b ? b->next : head;
+    (n->next ? n->next->prev : tail) = n;
+    (b ? b->next : head) = n;
+    blocks++;
+    return n;
+  }
+
+  void Unlink(Block* b) {
+    (b->prev ? b->prev->next : head) = b->next;
+    (b->next ? b->next->prev : tail) = b->prev;
+    delete b;
+    blocks--;
+  }
+
+  // Merges two sorted chains into a new chain of full blocks, freeing the input blocks as they drain
+  template <typename Compare>
+  static Chain MergeChains(Chain a, Chain b, Compare& comp) {
+    Chain out{ nullptr, nullptr };
+    Block* ab = a.first;
+    Block* bb = b.first;
+    std::size_t ai = 0, bi = 0;
+    auto take = [&out](T& x) {
+      if (out.last == nullptr || out.last->count == BlockSize) {
+        Block* n = new Block;
+        n->prev = out.last;
+        (out.last ? out.last->next : out.first) = n;
+        out.last = n;
+      }
+      new (out.last->data() + out.last->count) T(std::move(x));
+      x.~T();
+      out.last->count++;
+    };
+    auto advance = [](Block*& blk, std::size_t& idx) {
+      if (++idx == blk->count) {
+        Block* next = blk->next;
+        blk->count = 0; // elements were already moved out and destroyed
+        delete blk;
+        blk = next;
+        idx = 0;
+      }
+    };
+    while (ab && bb) {
+      if (comp((*bb)[bi], (*ab)[ai])) { // take from `a` on ties: stable
+        take((*bb)[bi]);
+        advance(bb, bi);
+      } else {
+        take((*ab)[ai]);
+        advance(ab, ai);
+      }
+    }
+    for (; ab; advance(ab, ai)) {
+      take((*ab)[ai]);
+    }
+    for (; bb; advance(bb, bi)) {
+      take((*bb)[bi]);
+    }
+    return out;
+  }
+
+  void Adopt(Chain c, size_type total) {
+    head = c.first;
+    tail = c.last;
+    count = total;
+    blocks = 0;
+    for (Block* b = head; b; b = b->next) {
+      blocks++;
+    }
+  }
+
+  void Swap(UnrolledList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(count, other.count);
+    std::swap(blocks, other.blocks);
+  }
+
+  Block* head = nullptr;
+  Block* tail = nullptr;
+  size_type count = 0;
+  size_type blocks = 0;
+};
+
+// Bidirectional iterator: (block, index in block); `end()` is (nullptr, 0)
+template <typename T, std::size_t BlockSize>
+template <bool IsConst>
+class UnrolledList<T, BlockSize>::Iterator
+{
+  using List = std::conditional_t<IsConst, const UnrolledList, UnrolledList>;
+  friend class UnrolledList;
+  friend class Iterator<!IsConst>;
+
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+
+  Iterator() = default;
+  template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+  Iterator(const Iterator<WasConst>& other) : list(other.list), block(other.block), index(other.index) {}
+
+  reference operator*() const { return (*block)[index]; }
+  pointer operator->() const { return &(*block)[index]; }
+
+  Iterator& operator++() {
+    if (++index == block->count) {
+      block = block->next;
+      index = 0;
+    }
+    return *this;
+  }
+  Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+  Iterator& operator--() {
+    if (block == nullptr) {
+      block = list->tail;
+      index = block->count - 1;
+    } else if (index == 0) {
+      block = block->prev;
+      index = block->count - 1;
+    } else {
+      --index;
+    }
+    return *this;
+  }
+  Iterator operator--(int) { Iterator old = *this; --*this; return old; }
+
+  friend bool operator==(const Iterator& a, const Iterator& b) { return a.block == b.block && a.index == b.index; }
+  friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+private:
+  Iterator(List* l, Block* b, std::size_t i) : list(l), block(b), index(i) {}
+
+  List* list = nullptr;
+  Block* block = nullptr;
+  std::size_t index = 0;
+};
@@ -0,0 +1,173 @@
+// Demo: Unrolled linked list vs. std::list
+
+#include <algorithm>
+using std::equal;
+using std::find;
+using std::is_sorted;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <iterator>
+using std::begin;
+using std::end;
+using std::next;
+#include <list>
+using std::list;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+using std::to_string;
+#include <vector>
+using std::vector;
+
+#include "UnrolledList.h"
+
+
+template <typename Func>
+double TimeMs(Func f) {
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Erasing 31 of every 32 elements must not leave a trail of nearly empty blocks: each is kept at
+// least a quarter full; then random erasures and insertions of strings, checked against std::list
+template <size_t BlockSize>
+bool CheckErase(mt19937& gen) {
+  UnrolledList<int, BlockSize> l;
+  list<int> expected;
+  for (int i = 0; i < 32'000; i++) {
+    l.push_back(i);
+    expected.push_back(i);
+  }
+  auto e = begin(expected);
+  for (auto it = begin(l); it != end(l); ) {
+    if (*it % 32 == 0) {
+      ++it;
+      ++e;
+    } else {
+      it = l.erase(it);
+      e = expected.erase(e);
+      if ((it == end(l)) != (e == end(expected)) || (it != end(l) && *it != *e)) {
+        return false;
+      }
+    }
+  }
+  if (l.size() != expected.size() || !equal(begin(l), end(l), begin(expected), end(expected)) ||
+      (l.blockCount() - 1) * (BlockSize / 4) > l.size()) {
+    return false;
+  }
+
+  UnrolledList<string, BlockSize> words;
+  list<string> expectedWords;
+  for (int step = 0; step < 20'000; step++) {
+    size_t at = uniform_int_distribution<size_t>(0, expectedWords.size())(gen);
+    if (at < expectedWords.size() && uniform_int_distribution<int>(0, 9)(gen) < 5) {
+      auto it = words.erase(next(begin(words), static_cast<std::ptrdiff_t>(at)));
+      auto e = expectedWords.erase(next(begin(expectedWords), static_cast<std::ptrdiff_t>(at)));
+      if ((it == end(words)) != (e == end(expectedWords)) || (it != end(words) && *it != *e)) {
+        return false;
+      }
+    } else {
+      string word = "word number " + to_string(step) + ", too long for the small string buffer";
+      words.insert(next(begin(words), static_cast<std::ptrdiff_t>(at)), word);
+      expectedWords.insert(next(begin(expectedWords), static_cast<std::ptrdiff_t>(at)), word);
+    }
+    if (words.size() != expectedWords.size() || !equal(begin(words), end(words), begin(expectedWords), end(expectedWords))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The same steps on each container; returns the final contents for comparison
+template <typename List>
+vector<int> Run(const char* name, const vector<int>& values) {
+  List l;
+  List other;
+  double pushMs = TimeMs([&]() {
+    for (int x : values) {
+      l.push_back(x);
+    }
+  });
+  long long sum = 0;
+  double iterateMs = TimeMs([&]() {
+    for (int round = 0; round < 10; round++) {
+      for (int x : l) {
+        sum += x;
+      }
+    }
+  });
+  double findInsertMs = TimeMs([&]() { // like inserting Earth before Mars
+    for (int k = 0; k < 100; k++) {
+      auto pos = find(begin(l), end(l), values[values.size() / 2 + k]);
+      l.insert(pos, -k);
+    }
+  });
+  double sortMs = TimeMs([&]() { l.sort(); });
+  for (int x : values) {
+    other.push_back(x / 2);
+  }
+  other.sort();
+  double mergeMs = TimeMs([&]() { l.merge(other); });
+  List tail;
+  tail.push_back(1);
+  tail.push_back(2);
+  double spliceMs = TimeMs([&]() { l.splice(begin(l), tail); });
+
+  cout << ' ' << name << ":\n\tpush_back " << pushMs << " ms, iterate x10 " << iterateMs << " ms, find+insert x100 "
+       << findInsertMs << " ms, sort " << sortMs << " ms, merge " << mergeMs << " ms, splice " << spliceMs
+       << " ms (checksum " << sum << ")\n";
+  return vector<int>(begin(l), end(l));
+}
+
+int main(int argc, char* argv[]) {
+  // usage: UnrolledListDemo [elements]
+  size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  // Same steps as `List.cpp` and `ListSort.cpp`
+  UnrolledList<string, 4> planets{ "Venus", "Mars", "Jupiter", "Saturn", "Uranus" };
+  planets.push_front("Mercury");
+  planets.push_back("Neptune");
+  auto pos = find(begin(planets), end(planets), "Mars");
+  planets.insert(pos, "Earth");
+  cout << " List of planets: \n  ";
+  for (auto const& name : planets) {
+    cout << ' ' << name;
+  }
+  planets.sort();
+  cout << "\n Sorted list of planets (alphabetical order): \n  ";
+  for (auto const& name : planets) {
+    cout << ' ' << name;
+  }
+  cout << "\n\n " << count << " ints: \n";
+
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> dist(0, 1'000'000'000);
+  vector<int> values(count);
+  for (auto& x : values) {
+    x = dist(gen);
+  }
+
+  // N.B. `std::list` runs last: freeing millions of its small nodes leaves the heap fragmented, and
+  // glibc's malloc then slows down the next allocations of a different size (here, the blocks)
+  auto unrolled = Run<UnrolledList<int, 32>>("UnrolledList<int, 32>", values);
+  auto unrolled64 = Run<UnrolledList<int, 64>>("UnrolledList<int, 64>", values);
+  auto expected = Run<list<int>>("std::list", values);
+
+  bool ok = unrolled == expected && unrolled64 == expected && is_sorted(begin(expected) + 2, end(expected));
+  bool erased = CheckErase<4>(gen) && CheckErase<32>(gen) && CheckErase<64>(gen);
+  cout << (ok ? "\n Results match std::list. \n" : "\n ERROR: results differ from std::list! \n");
+  cout << (erased ? " Erasing matches std::list and keeps blocks at least a quarter full. \n"
+                  : " ERROR: erasing differs from std::list or leaves sparse blocks! \n");
+  ok = ok && erased;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include <algorithm>
+using std::search;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <functional>
+using std::boyer_moore_horspool_searcher;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include "Searchers.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Random haystacks and patterns over tiny alphabets (lots of partial matches and periodic patterns)
+bool CheckAgainstSearch(mt19937& gen)
+{
+  for (int trial = 0; trial < 100'000; trial++)
+  {
+    uniform_int_distribution<int> letters(1, 4);
+    uniform_int_distribution<size_t> length(0, 64);
+    char top = static_cast<char>('a' + letters(gen) - 1);
+    uniform_int_distribution<int> letter('a', top);
+    string haystack(length(gen), ' ');
+    string needle(length(gen) % 12, ' ');
+    for (auto& c : haystack)
+    {
+      c = static_cast<char>(letter(gen));
+    }
+    for (auto& c : needle)
+    {
+      c = static_cast<char>(letter(gen));
+    }
+    auto expected = search(begin(haystack), end(haystack), begin(needle), end(needle));
+    if (search(begin(haystack), end(haystack), HorspoolSearcher(begin(needle), end(needle))) != expected ||
+      search(begin(haystack), end(haystack), TwoWaySearcher(begin(needle), end(needle))) != expected ||
+      search(begin(haystack), end(haystack), SimdSearcher(begin(needle), end(needle))) != expected)
+    {
+      cout << " MISMATCH searching for \"" << needle << "\" in \"" << haystack << "\"\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: FastSearch [largest haystack in bytes] -- from 1 KB up to the largest (default 1 GB)
+  size_t largest = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : size_t{ 1 } << 30;
+
+  // Same searches as `FindVariations.cpp`
+  vector<int> v{ 4, 6, 6, 1, 3, -2, 0, 11, 2, 3, 2, 4, 4, 2, 4 };
+  string s{ "Hello I am a sentence" };
+  vector<int> subsequence{ 2,4 };
+  auto result = search(begin(v), end(v), HorspoolSearcher(begin(subsequence), end(subsequence)));
+  string am = "am";
+  auto letter = search(begin(s), end(s), TwoWaySearcher(begin(am), end(am)));
+  auto letter2 = search(begin(s), end(s), SimdSearcher(begin(am), end(am)));
+  cout << " {2,4} found at index " << result - begin(v) << ", \"am\" found at index " << letter - begin(s)
+       << " (and " << letter2 - begin(s) << ")\n";
+
+  mt19937 gen{ 1846 };
+  bool ok = CheckAgainstSearch(gen);
+
+  // Text-like haystack: lowercase letters and spaces; the needle only occurs at the very end
+  string text(std::max<size_t>(largest, 1024), ' ');
+  uniform_int_distribution<int> letters('a', 'z' + 5);
+  for (auto& c : text)
+  {
+    int x = letters(gen);
+    c = x > 'z' ? ' ' : static_cast<char>(x);
+  }
+  const string needle = "the quick brown fox jumps";
+  HorspoolSearcher horspool(begin(needle), end(needle));
+  TwoWaySearcher twoWay(begin(needle), end(needle));
+  SimdSearcher simd(begin(needle), end(needle));
+  boyer_moore_horspool_searcher stdHorspool(begin(needle), end(needle));
+  cout << "\n searching for \"" << needle << "\":\n";
+  for (size_t size = 1024; size <= text.size(); size *= 32)
+  {
+    auto first = begin(text);
+    auto last = first + static_cast<std::ptrdiff_t>(size);
+    std::copy(begin(needle), end(needle), last - static_cast<std::ptrdiff_t>(needle.size()));
+    const int repeats = static_cast<int>(std::max<size_t>(1, (size_t{ 1 } << 26) / size));
+    auto expected = search(first, last, begin(needle), end(needle));
+    bool match = true;
+    auto perSearch = [&](auto searchOnce)
+      {
+        double ms = TimeMs([&]()
+          {
+            for (int r = 0; r < repeats; r++)
+            {
+              match = searchOnce() == expected && match;
+            }
+          });
+        return ms / repeats;
+      };
+    double naiveMs = perSearch([&]() { return search(first, last, begin(needle), end(needle)); });
+    double stdHorspoolMs = perSearch([&]() { return search(first, last, stdHorspool); });
+    double horspoolMs = perSearch([&]() { return search(first, last, horspool); });
+    double twoWayMs = perSearch([&]() { return search(first, last, twoWay); });
+    double simdMs = perSearch([&]() { return search(first, last, simd); });
+    cout << '\t' << size / 1024 << " KB:\tstd::search " << naiveMs << " ms, std::boyer_moore_horspool_searcher "
+         << stdHorspoolMs << " ms, HorspoolSearcher " << horspoolMs << " ms, TwoWaySearcher " << twoWayMs
+         << " ms, SimdSearcher " << simdMs << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+    std::fill(last - static_cast<std::ptrdiff_t>(needle.size()), last, '-'); // so the next, larger search doesn't find this copy
+  }
+
+  // Subsequences of ints: few distinct values, so plenty of partial matches
+  vector<int> numbers(10'000'000);
+  uniform_int_distribution<int> digits(0, 99);
+  for (auto& x : numbers)
+  {
+    x = digits(gen);
+  }
+  vector<int> pattern{ 12, 7, 42, 42, 3, 99, 0, 12, 64, 5 };
+  std::copy(begin(pattern), end(pattern), end(numbers) - static_cast<std::ptrdiff_t>(pattern.size()));
+  vector<int>::iterator expected;
+  vector<int>::iterator found;
+  vector<int>::iterator stdFound;
+  double naiveMs = TimeMs([&]() { expected = search(begin(numbers), end(numbers), begin(pattern), end(pattern)); });
+  double stdHorspoolMs = TimeMs([&]() { stdFound = search(begin(numbers), end(numbers), boyer_moore_horspool_searcher(begin(pattern), end(pattern))); });
+  double horspoolMs = TimeMs([&]() { found = search(begin(numbers), end(numbers), HorspoolSearcher(begin(pattern), end(pattern))); });
+  cout << "\n searching " << numbers.size() << " ints for " << pattern.size() << " ints:\tstd::search " << naiveMs
+       << " ms, std::boyer_moore_horspool_searcher " << stdHorspoolMs << " ms, HorspoolSearcher " << horspoolMs << " ms"
+       << (found == expected && stdFound == expected ? "" : " -- MISMATCH!") << '\n';
+  ok = ok && found == expected;
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Searcher objects for `std::search(first, last, searcher)` (C++17): each is constructed from the
+// pattern once, then `searcher(first, last)` returns the [begin, end) of the first match, or
+// {last, last} if there is none
+//   * HorspoolSearcher -- Boyer-Moore-Horspool for any element type: a 256-entry shift table for
+//     bytes, a dense table for other integers (if the pattern spans a small range of values), a
+//     hash map otherwise (e.g., for `vector<int>` subsequences)
+//   * TwoWaySearcher -- Crochemore-Perrin Two-Way for bytes: linear time even for repetitive
+//     patterns (e.g., "aaaab"), plus a Horspool skip on the byte under the end of the pattern
+//   * SimdSearcher -- for bytes: compares the first and last pattern byte against 32 positions at
+//     once (AVX2), and only checks the rest of the pattern where both match
+// The byte searchers require contiguous haystacks (e.g., `std::string`, `std::vector<char>`)
+
+template <typename T>
+constexpr bool IsByteLike = std::is_integral_v<T> && sizeof(T) == 1;
+
+// Pointer to the element at `it` of a contiguous range (which may be `end()`)
+template <typename It>
+const unsigned char* BytePointer(It first, It it)
+{
+  return reinterpret_cast<const unsigned char*>(std::addressof(*first)) + (it - first);
+}
+
+template <typename T>
+class HorspoolSearcher
+{
+public:
+  template <typename PatternIt>
+  HorspoolSearcher(PatternIt first, PatternIt last) : pattern(first, last)
+  {
+    std::ptrdiff_t m = static_cast<std::ptrdiff_t>(pattern.size());
+    if constexpr (IsByteLike<T>)
+    {
+      byteShift.fill(m);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+      // Integers spanning a small range of values: a dense table rather than the hash map
+      if (m > 1)
+      {
+        auto [low, high] = std::minmax_element(pattern.begin(), pattern.end() - 1);
+        if (static_cast<unsigned long long>(*high) - static_cast<unsigned long long>(*low) < DenseLimit)
+        {
+          denseLow = *low;
+          denseShift.assign(static_cast<std::size_t>(*high - *low) + 1, m);
+          for (std::ptrdiff_t i = 0; i + 1 < m; i++)
+          {
+            denseShift[static_cast<std::size_t>(pattern[i] - denseLow)] = m - 1 - i;
+          }
+          return;
+        }
+      }
+    }
+    // Distance from the last occurrence of each element (except the final one) to the end
+    for (std::ptrdiff_t i = 0; i + 1 < m; i++)
+    {
+      if constexpr (IsByteLike<T>)
+      {
+        byteShift[static_cast<unsigned char>(pattern[i])] = m - 1 - i;
+      }
+      else
+      {
+        shift[pattern[i]] = m - 1 - i;
+      }
+    }
+  }
+
+  template <typename It>
+  std::pair<It, It> operator()(It first, It last) const
+  {
+    const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(pattern.size());
+    const std::ptrdiff_t n = last - first;
+    if (m == 0)
+    {
+      return { first, first };
+    }
+    for (std::ptrdiff_t pos = 0; pos + m <= n; )
+    {
+      const auto& lastElement = first[pos + m - 1];
+      if (same(lastElement, pattern[m - 1]) && std::equal(pattern.begin(), pattern.end() - 1, first + pos, [](const auto& a, const auto& b) { return same(a, b); }))
+      {
+        return { first + pos, first + pos + m };
+      }
+      pos += skip(lastElement, m);
+    }
+    return { last, last };
+  }
+
+private:
+  // Bytes compare as `unsigned char`, so a `char` haystack matches an `unsigned char` pattern
+  template <typename A, typename B>
+  static bool same(const A& a, const B& b)
+  {
+    if constexpr (IsByteLike<T>)
+    {
+      return static_cast<unsigned char>(a) == static_cast<unsigned char>(b);
+    }
+    else
+    {
+      return a == b;
+    }
+  }
+
+  template <typename U>
+  std::ptrdiff_t skip(const U& x, std::ptrdiff_t m) const
+  {
+    if constexpr (IsByteLike<T>)
+    {
+      return byteShift[static_cast<unsigned char>(x)];
+    }
+    else
+    {
+      if constexpr (std::is_integral_v<T>)
+      {
+        if (!denseShift.empty())
+        {
+          // N.B. unsigned wraparound sends values below `denseLow` past the end of the table too
+          auto index = static_cast<std::size_t>(static_cast<unsigned long long>(x) - static_cast<unsigned long long>(denseLow));
+          return index < denseShift.size() ? denseShift[index] : m;
+        }
+      }
+      auto found = shift.find(x);
+      return found == shift.end() ? m : found->second;
+    }
+  }
+
+  static constexpr unsigned long long DenseLimit = 1 << 16;
+
+  std::vector<T> pattern;
+  std::array<std::ptrdiff_t, 256> byteShift{}; // unused unless T is a byte
+  T denseLow{};
+  std::vector<std::ptrdiff_t> denseShift;
+  std::unordered_map<T, std::ptrdiff_t> shift;
+};
+
+template <typename PatternIt>
+HorspoolSearcher(PatternIt, PatternIt) -> HorspoolSearcher<typename std::iterator_traits<PatternIt>::value_type>;
+
+class TwoWaySearcher
+{
+public:
+  template <typename PatternIt>
+  TwoWaySearcher(PatternIt first, PatternIt last)
+  {
+    static_assert(IsByteLike<typename std::iterator_traits<PatternIt>::value_type>, "TwoWaySearcher searches for bytes");
+    for (; first != last; ++first)
+    {
+      pattern.push_back(static_cast<unsigned char>(*first));
+    }
+    const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(pattern.size());
+    if (m == 0)
+    {
+      return;
+    }
+    lastShift.fill(m);
+    for (std::ptrdiff_t i = 0; i < m; i++)
+    {
+      lastShift[pattern[i]] = m - 1 - i; // 0 for the last byte of the pattern
+    }
+    // Critical factorization pattern = u v, |u| = split + 1: the later of the two maximal
+    // suffixes (for < and for >), with the period of the pattern
+    std::ptrdiff_t p = 0;
+    std::ptrdiff_t q = 0;
+    std::ptrdiff_t i = maximalSuffix(false, p);
+    std::ptrdiff_t j = maximalSuffix(true, q);
+    split = i > j ? i : j;
+    period = i > j ? p : q;
+    periodic = split + 1 + period <= m && std::memcmp(pattern.data(), pattern.data() + period, static_cast<std::size_t>(split + 1)) == 0;
+    if (!periodic)
+    {
+      period = std::max(split + 1, m - split - 1) + 1;
+    }
+  }
+
+  template <typename It>
+  std::pair<It, It> operator()(It first, It last) const
+  {
+    const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(pattern.size());
+    const std::ptrdiff_t n = last - first;
+    if (m == 0)
+    {
+      return { first, first };
+    }
+    if (n < m)
+    {
+      return { last, last };
+    }
+    const unsigned char* y = BytePointer(first, first);
+    const unsigned char* x = pattern.data();
+    std::ptrdiff_t pos = 0;
+    std::ptrdiff_t memory = -1; // periodic: the prefix of length memory + 1 is already known to match
+    while (pos <= n - m)
+    {
+      // Like Horspool: unless the byte under the end of the pattern occurs in it, skip ahead
+      if (std::ptrdiff_t skip = lastShift[y[pos + m - 1]])
+      {
+        pos += skip;
+        memory = -1;
+        continue;
+      }
+      // Right half first, left to right...
+      std::ptrdiff_t i = std::max(split, periodic ? memory : -1) + 1;
+      while (i < m && x[i] == y[pos + i])
+      {
+        i++;
+      }
+      if (i < m)
+      {
+        pos += i - split;
+        memory = -1;
+        continue;
+      }
+      // ...then the left half, right to left
+      i = split;
+      const std::ptrdiff_t stop = periodic ? memory : -1;
+      while (i > stop && x[i] == y[pos + i])
+      {
+        i--;
+      }
+      if (i <= stop)
+      {
+        return { first + pos, first + pos + m };
+      }
+      pos += period;
+      if (periodic)
+      {
+        memory = m - period - 1;
+      }
+    }
+    return { last, last };
+  }
+
+private:
+  // Start (minus one) of the maximal suffix of the pattern for < (or > if `reversed`), and its period
+  std::ptrdiff_t maximalSuffix(bool reversed, std::ptrdiff_t& p) const
+  {
+    const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(pattern.size());
+    std::ptrdiff_t ms = -1;
+    std::ptrdiff_t j = 0;
+    std::ptrdiff_t k = 1;
+    p = 1;
+    while (j + k < m)
+    {
+      unsigned char a = pattern[j + k];
+      unsigned char b = pattern[ms + k];
+      if (reversed ? a > b : a < b)
+      {
+        j += k;
+        k = 1;
+        p = j - ms;
+      }
+      else if (a == b)
+      {
+        if (k != p)
+        {
+          k++;
+        }
+        else
+        {
+          j += p;
+          k = 1;
+        }
+      }
+      else
+      {
+        ms = j;
+        j = ms + 1;
+        k = p = 1;
+      }
+    }
+    return ms;
+  }
+
+  std::vector<unsigned char> pattern;
+  std::array<std::ptrdiff_t, 256> lastShift{};
+  std::ptrdiff_t split = -1;
+  std::ptrdiff_t period = 1;
+  bool periodic = false;
+};
+
+class SimdSearcher
+{
+public:
+  template <typename PatternIt>
+  SimdSearcher(PatternIt first, PatternIt last) : fallback(first, last)
+  {
+    static_assert(IsByteLike<typename std::iterator_traits<PatternIt>::value_type>, "SimdSearcher searches for bytes");
+    for (; first != last; ++first)
+    {
+      pattern.push_back(static_cast<unsigned char>(*first));
+    }
+  }
+
+  template <typename It>
+  std::pair<It, It> operator()(It first, It last) const
+  {
+    const std::size_t m = pattern.size();
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (m == 0)
+    {
+      return { first, first };
+    }
+    if (n < m)
+    {
+      return { last, last };
+    }
+    const unsigned char* y = BytePointer(first, first);
+    std::size_t pos = 0;
+    if (m == 1)
+    {
+      const void* found = std::memchr(y, pattern[0], n);
+      return found == nullptr ? std::pair<It, It>{ last, last }
+        : std::pair<It, It>{ first + (static_cast<const unsigned char*>(found) - y), first + (static_cast<const unsigned char*>(found) - y) + 1 };
+    }
+#if defined(__AVX2__)
+    const __m256i head = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+    const __m256i tail = _mm256_set1_epi8(static_cast<char>(pattern[m - 1]));
+    for (; pos + m - 1 + 32 <= n; pos += 32)
+    {
+      __m256i firsts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + pos));
+      __m256i lasts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + pos + m - 1));
+      unsigned candidates = static_cast<unsigned>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(firsts, head), _mm256_cmpeq_epi8(lasts, tail))));
+      while (candidates != 0)
+      {
+        std::size_t match = pos + static_cast<std::size_t>(__builtin_ctz(candidates));
+        if (m == 2 || std::memcmp(y + match + 1, pattern.data() + 1, m - 2) == 0)
+        {
+          return { first + match, first + match + m };
+        }
+        candidates &= candidates - 1;
+      }
+    }
+#endif
+    // The last few positions (or all of them without AVX2)
+    return fallback(first + pos, last);
+  }
+
+private:
+  std::vector<unsigned char> pattern;
+  HorspoolSearcher<unsigned char> fallback;
+};
@@ -0,0 +1,157 @@
+#include <vector>
+using std::vector;
+#include <deque>
+using std::deque;
+#include <string>
+using std::string;
+#include <algorithm>
+using std::find_first_of;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <unordered_set>
+using std::unordered_set;
+#include "NeedleSet.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Random bytes and random needle sets, including the full range of byte values
+bool CheckAgainstFindFirstOf(mt19937& gen)
+{
+  uniform_int_distribution<int> byte(0, 255);
+  uniform_int_distribution<size_t> length(0, 100);
+  for (int trial = 0; trial < 100'000; trial++)
+  {
+    string haystack(length(gen), ' ');
+    string needles(length(gen) % 40, ' ');
+    for (auto& c : haystack)
+    {
+      c = static_cast<char>(byte(gen));
+    }
+    for (auto& c : needles)
+    {
+      c = static_cast<char>(byte(gen));
+    }
+    vector<int> numbers(begin(haystack), end(haystack));
+    vector<int> numberNeedles(begin(needles), end(needles));
+    if (FindFirstOf(begin(haystack), end(haystack), begin(needles), end(needles)) != find_first_of(begin(haystack), end(haystack), begin(needles), end(needles)) ||
+      FindFirstOf(begin(numbers), end(numbers), begin(numberNeedles), end(numberNeedles)) != find_first_of(begin(numbers), end(numbers), begin(numberNeedles), end(numberNeedles)))
+    {
+      cout << " MISMATCH!\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Haystacks of another type than the needles, or not contiguous: values the needle type can't
+// represent, e.g., an int 0x161 for a char needle 'a' (0x61), must not match; a `std::deque`
+// must not be read as raw memory
+bool CheckMixedTypes(mt19937& gen)
+{
+  uniform_int_distribution<int> value(-400, 400);
+  uniform_int_distribution<size_t> length(0, 100);
+  for (int trial = 0; trial < 100'000; trial++)
+  {
+    vector<int> numbers(length(gen));
+    string needles(length(gen) % 40, ' ');
+    for (auto& x : numbers)
+    {
+      x = value(gen);
+    }
+    for (auto& c : needles)
+    {
+      c = static_cast<char>(value(gen));
+    }
+    vector<unsigned char> bytes(begin(numbers), end(numbers));
+    deque<char> chunks(begin(numbers), end(numbers)); // random access, but not contiguous
+    if (FindFirstOf(begin(numbers), end(numbers), begin(needles), end(needles)) != find_first_of(begin(numbers), end(numbers), begin(needles), end(needles)) ||
+      FindFirstOf(begin(bytes), end(bytes), begin(needles), end(needles)) != find_first_of(begin(bytes), end(bytes), begin(needles), end(needles)) ||
+      FindFirstOf(begin(chunks), end(chunks), begin(needles), end(needles)) != find_first_of(begin(chunks), end(chunks), begin(needles), end(needles)))
+    {
+      cout << " MISMATCH (mixed types)!\n";
+      return false;
+    }
+  }
+  vector<int> wide{ 0x161, 'a' };
+  string a = "a";
+  return FindFirstOf(begin(wide), end(wide), begin(a), end(a)) == begin(wide) + 1;
+}
+
+// Haystack values are drawn from `values` but never equal a needle, except for one near the end
+template <typename T, typename Dist>
+bool Bench(const char* what, size_t n, size_t needleCount, Dist values, mt19937& gen)
+{
+  unordered_set<T> unique;
+  while (unique.size() < needleCount)
+  {
+    unique.insert(static_cast<T>(values(gen)));
+  }
+  vector<T> needles(begin(unique), end(unique));
+  vector<T> haystack(n);
+  for (auto& x : haystack)
+  {
+    do
+    {
+      x = static_cast<T>(values(gen));
+    } while (unique.count(x) != 0);
+  }
+  haystack[n / 10 * 9] = needles.back();
+
+  typename vector<T>::iterator expected;
+  typename vector<T>::iterator found;
+  double stdMs = TimeMs([&]() { expected = find_first_of(begin(haystack), end(haystack), begin(needles), end(needles)); });
+  double fastMs = TimeMs([&]() { found = FindFirstOf(begin(haystack), end(haystack), begin(needles), end(needles)); });
+  cout << '\t' << what << ", " << needleCount << " needle(s):\tstd::find_first_of " << stdMs << " ms, FindFirstOf "
+       << fastMs << " ms (speedup " << stdMs / fastMs << "x)" << (found == expected ? "" : " -- MISMATCH!") << '\n';
+  return found == expected;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: FindFirstOf [bytes] -- the int haystacks are 1/16 as long
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 16'000'000;
+
+  // Same search as `FindVariations.cpp`
+  vector<int> v{ 4, 6, 6, 1, 3, -2, 0, 11, 2, 3, 2, 4, 4, 2, 4 };
+  vector<int> primes{ 1,2,3,5,7,11,13 };
+  auto result = FindFirstOf(begin(v), end(v), begin(primes), end(primes));
+  cout << " first of the primes: " << *result << " (index " << result - begin(v) << ")\n\n";
+
+  mt19937 gen{ 1846 };
+  bool ok = CheckAgainstFindFirstOf(gen);
+  ok = CheckMixedTypes(gen) && ok;
+
+  cout << ' ' << n << " bytes:\n";
+  for (size_t needles : { 1, 4, 16, 64, 200 })
+  {
+    ok = Bench<unsigned char>("bytes", n, needles, uniform_int_distribution<int>(0, 255), gen) && ok;
+  }
+  cout << ' ' << n / 16 << " ints:\n";
+  for (size_t needles : { 1, 10, 100, 1000 })
+  {
+    ok = Bench<int>("ints in [0, 10^6)", n / 16, needles, uniform_int_distribution<int>(0, 999'999), gen) && ok;
+  }
+  for (size_t needles : { 1, 10, 100, 1000 })
+  {
+    ok = Bench<int>("any ints", n / 16, needles, uniform_int_distribution<int>(), gen) && ok;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// `std::find_first_of(first, last, sfirst, slast)` compares each element with every needle:
+// O(n * m); a `NeedleSet` is built from the needles once, then tests each element in O(1)
+//   * bytes: a 256-bit set; with AVX2, 32 bytes are classified per step with two 16-entry
+//     tables indexed by the low nibble (one row per half of the high nibbles), i.e., `vpshufb`
+//   * other integers: a small hashed bit filter that rejects most non-needles, then a bitset over
+//     [min, max] of the needles if that range is small, otherwise a hash set
+// The AVX2 byte version only runs on contiguous haystacks (pointers, `std::string` and
+// `std::vector` iterators); others use the generic loop, which also compares a haystack of another
+// type by value, as `std::find_first_of()` does
+
+// Whether the AVX2 byte path can read [first, last) as raw memory: a pointer, or a `std::vector`
+// or `std::string` iterator, to byte-sized characters (`std::array` iterators are pointers in
+// libstdc++); e.g., `std::deque<char>` iterators are random access, but not contiguous
+template <typename It>
+constexpr bool IsContiguousByteIterator()
+{
+  using V = std::remove_cv_t<typename std::iterator_traits<It>::value_type>;
+  if constexpr (!std::is_same_v<V, char> && !std::is_same_v<V, signed char> && !std::is_same_v<V, unsigned char>)
+  {
+    return false;
+  }
+  else if constexpr (std::is_pointer_v<It>)
+  {
+    return true;
+  }
+  else if constexpr (std::is_same_v<V, char>)
+  {
+    return std::is_same_v<It, typename std::vector<V>::iterator> || std::is_same_v<It, typename std::vector<V>::const_iterator>
+      || std::is_same_v<It, std::string::iterator> || std::is_same_v<It, std::string::const_iterator>;
+  }
+  else
+  {
+    return std::is_same_v<It, typename std::vector<V>::iterator> || std::is_same_v<It, typename std::vector<V>::const_iterator>;
+  }
+}
+
+template <typename T>
+class NeedleSet
+{
+  static_assert(std::is_integral_v<T>, "NeedleSet holds integers (including characters)");
+
+public:
+  template <typename It>
+  NeedleSet(It first, It last)
+  {
+    if constexpr (sizeof(T) == 1)
+    {
+      for (; first != last; ++first)
+      {
+        auto b = static_cast<unsigned char>(*first);
+        bits[b >> 6] |= std::uint64_t{ 1 } << (b & 63);
+        // row (low nibble) of the table for high nibbles 0-7 or 8-15; bit (high nibble & 7)
+        (b >> 7 ? highRows : lowRows)[b & 15] |= static_cast<unsigned char>(1u << ((b >> 4) & 7));
+      }
+    }
+    else
+    {
+      std::vector<T> needles(first, last);
+      if (needles.empty())
+      {
+        return;
+      }
+      for (T x : needles)
+      {
+        std::size_t h = filterBit(x);
+        filter[h >> 6] |= std::uint64_t{ 1 } << (h & 63);
+      }
+      auto [low, high] = std::minmax_element(needles.begin(), needles.end());
+      if (static_cast<unsigned long long>(*high) - static_cast<unsigned long long>(*low) < DenseLimit)
+      {
+        denseLow = *low;
+        dense.assign((static_cast<std::size_t>(*high - *low) >> 6) + 1, 0);
+        for (T x : needles)
+        {
+          auto i = static_cast<std::size_t>(x - denseLow);
+          dense[i >> 6] |= std::uint64_t{ 1 } << (i & 63);
+        }
+      }
+      else
+      {
+        sparse.insert(needles.begin(), needles.end());
+      }
+    }
+  }
+
+  bool contains(T x) const
+  {
+    if constexpr (sizeof(T) == 1)
+    {
+      auto b = static_cast<unsigned char>(x);
+      return (bits[b >> 6] >> (b & 63)) & 1;
+    }
+    else if (std::size_t h = filterBit(x); !((filter[h >> 6] >> (h & 63)) & 1))
+    {
+      return false; // most non-needles stop here, in a table small enough to stay in L1
+    }
+    else if (!dense.empty())
+    {
+      // N.B. unsigned wraparound sends values below `denseLow` past the end of the set too
+      auto i = static_cast<std::size_t>(static_cast<unsigned long long>(x) - static_cast<unsigned long long>(denseLow));
+      return (i >> 6) < dense.size() && ((dense[i >> 6] >> (i & 63)) & 1);
+    }
+    else
+    {
+      return sparse.count(x) != 0;
+    }
+  }
+
+  // Same as `std::find_first_of(first, last, <needles>)`
+  template <typename It>
+  It find(It first, It last) const
+  {
+#if defined(__AVX2__)
+    using V = typename std::iterator_traits<It>::value_type;
+    if constexpr (sizeof(T) == 1 && IsContiguousByteIterator<It>() && std::is_signed_v<T> == std::is_signed_v<V>)
+    {
+      if (last - first >= 32)
+      {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(std::addressof(*first));
+        const std::ptrdiff_t n = last - first;
+        std::ptrdiff_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+          if (unsigned mask = classify(p + i))
+          {
+            return first + i + __builtin_ctz(mask);
+          }
+        }
+        if (i < n)
+        {
+          if (unsigned mask = classify(p + n - 32) >> (i - (n - 32))) // the last, overlapping 32 bytes
+          {
+            return first + i + __builtin_ctz(mask);
+          }
+        }
+        return last;
+      }
+    }
+#endif
+    // N.B. elements that `T` can't represent aren't needles, whatever they'd be narrowed to
+    return std::find_if(first, last, [this](const auto& x) { return representable(x) && contains(static_cast<T>(x)); });
+  }
+
+private:
+#if defined(__AVX2__)
+  // Bit i is set iff p[i] is a needle
+  unsigned classify(const unsigned char* p) const
+  {
+    const __m256i lowTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lowRows.data())));
+    const __m256i highTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(highRows.data())));
+    const __m256i bitOf = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+      1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i lowNibble = _mm256_and_si256(x, _mm256_set1_epi8(0x0F));
+    __m256i highNibble = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0F));
+    __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lowTable, lowNibble), _mm256_shuffle_epi8(highTable, lowNibble), x); // by the top bit of x
+    __m256i bit = _mm256_shuffle_epi8(bitOf, highNibble); // 1 << (high nibble & 7)
+    __m256i hit = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+    return static_cast<unsigned>(_mm256_movemask_epi8(hit));
+  }
+#endif
+
+  // Whether `x` has the same value as a `T` (as `std::in_range<T>(x)` for integers)
+  template <typename V>
+  static bool representable(const V& x)
+  {
+    if constexpr (!std::is_integral_v<V>)
+    {
+      return static_cast<T>(x) == x;
+    }
+    else if constexpr (std::is_signed_v<V> == std::is_signed_v<T>)
+    {
+      return x >= std::numeric_limits<T>::min() && x <= std::numeric_limits<T>::max();
+    }
+    else if constexpr (std::is_signed_v<V>)
+    {
+      return x >= 0 && static_cast<std::make_unsigned_t<V>>(x) <= std::numeric_limits<T>::max();
+    }
+    else
+    {
+      return x <= static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max());
+    }
+  }
+
+  static std::size_t filterBit(T x)
+  {
+    return static_cast<std::size_t>((static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ull) >> 50); // 14 bits
+  }
+
+  static constexpr unsigned long long DenseLimit = 1 << 20;
+
+  std::array<std::uint64_t, 4> bits{};           // bytes: the set itself
+  std::array<unsigned char, 16> lowRows{};       // bytes: the same set, for `vpshufb`
+  std::array<unsigned char, 16> highRows{};
+  std::array<std::uint64_t, 256> filter{};       // other integers: hashed 16384-bit filter, then...
+  T denseLow{};
+  std::vector<std::uint64_t> dense;              // other integers: bitset over [denseLow, max]
+  std::unordered_set<T> sparse;                  // ... or hash set if that range is too large
+};
+
+template <typename It>
+NeedleSet(It, It) -> NeedleSet<typename std::iterator_traits<It>::value_type>;
+
+// Same as `std::find_first_of(first, last, sfirst, slast)` for integers and characters
+template <typename It, typename NeedleIt>
+It FindFirstOf(It first, It last, NeedleIt sfirst, NeedleIt slast)
+{
+  return NeedleSet<typename std::iterator_traits<NeedleIt>::value_type>(sfirst, slast).find(first, last);
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include "ThreadPool.h"
+
+// Parallel `count()`, `count_if()`, `all_of()`/`any_of()`/`none_of()`, `find()`/`find_if()` and
+// `search()` for random access ranges, run on a `ThreadPool` (no TBB or execution policies needed)
+// The range is cut into a few chunks per thread; the searches check a shared flag or the best
+// position found so far between blocks, so the other threads stop early once the answer is known
+
+const std::ptrdiff_t ParallelMinChunk = 1 << 15; // smaller ranges aren't worth a thread
+const std::ptrdiff_t ParallelBlock = 1 << 12;    // elements between early-exit checks
+
+inline std::size_t ParallelChunkCount(const ThreadPool& pool, std::ptrdiff_t n)
+{
+  std::ptrdiff_t chunks = std::min<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(pool.size()) * 4, n / ParallelMinChunk);
+  return static_cast<std::size_t>(std::max<std::ptrdiff_t>(chunks, 1));
+}
+
+// Start and end offsets of chunk `i` of `chunks` over `n` elements
+inline std::ptrdiff_t ParallelChunkBegin(std::size_t i, std::size_t chunks, std::ptrdiff_t n)
+{
+  return static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(chunks));
+}
+
+template <typename It, typename Pred>
+typename std::iterator_traits<It>::difference_type ParallelCountIf(ThreadPool& pool, It first, It last, Pred pred)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = ParallelChunkCount(pool, n);
+  std::vector<std::ptrdiff_t> partials(chunks);
+  pool.run(chunks, [&](std::size_t i)
+    {
+      It begin = first + ParallelChunkBegin(i, chunks, n);
+      It end = first + ParallelChunkBegin(i + 1, chunks, n);
+      partials[i] = std::count_if(begin, end, pred);
+    });
+  std::ptrdiff_t total = 0;
+  for (auto p : partials)
+  {
+    total += p;
+  }
+  return total;
+}
+
+template <typename It, typename T>
+typename std::iterator_traits<It>::difference_type ParallelCount(ThreadPool& pool, It first, It last, const T& value)
+{
+  return ParallelCountIf(pool, first, last, [&value](const auto& x) { return x == value; });
+}
+
+template <typename It, typename Pred>
+bool ParallelAnyOf(ThreadPool& pool, It first, It last, Pred pred)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = ParallelChunkCount(pool, n);
+  std::atomic<bool> found{ false };
+  pool.run(chunks, [&](std::size_t i)
+    {
+      std::ptrdiff_t end = ParallelChunkBegin(i + 1, chunks, n);
+      for (std::ptrdiff_t b = ParallelChunkBegin(i, chunks, n); b < end; b += ParallelBlock)
+      {
+        if (found.load(std::memory_order_relaxed))
+        {
+          return; // another thread already has the answer
+        }
+        std::ptrdiff_t e = std::min(b + ParallelBlock, end);
+        if (std::any_of(first + b, first + e, pred))
+        {
+          found.store(true, std::memory_order_relaxed);
+          return;
+        }
+      }
+    });
+  return found.load();
+}
+
+template <typename It, typename Pred>
+bool ParallelNoneOf(ThreadPool& pool, It first, It last, Pred pred)
+{
+  return !ParallelAnyOf(pool, first, last, pred);
+}
+
+template <typename It, typename Pred>
+bool ParallelAllOf(ThreadPool& pool, It first, It last, Pred pred)
+{
+  return !ParallelAnyOf(pool, first, last, [&pred](const auto& x) { return !pred(x); });
+}
+
+// Lowers `best` to `pos` unless it's already lower
+inline void ParallelUpdateFirst(std::atomic<std::ptrdiff_t>& best, std::ptrdiff_t pos)
+{
+  std::ptrdiff_t current = best.load(std::memory_order_relaxed);
+  while (pos < current && !best.compare_exchange_weak(current, pos, std::memory_order_relaxed))
+  {
+  }
+}
+
+// Returns the *first* match, like `std::find_if()`: a thread stops as soon as a match has been
+// found before the block it's about to scan
+template <typename It, typename Pred>
+It ParallelFindIf(ThreadPool& pool, It first, It last, Pred pred)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = ParallelChunkCount(pool, n);
+  std::atomic<std::ptrdiff_t> best{ n };
+  pool.run(chunks, [&](std::size_t i)
+    {
+      std::ptrdiff_t end = ParallelChunkBegin(i + 1, chunks, n);
+      for (std::ptrdiff_t b = ParallelChunkBegin(i, chunks, n); b < end; b += ParallelBlock)
+      {
+        if (best.load(std::memory_order_relaxed) < b)
+        {
+          return;
+        }
+        std::ptrdiff_t e = std::min(b + ParallelBlock, end);
+        It found = std::find_if(first + b, first + e, pred);
+        if (found != first + e)
+        {
+          ParallelUpdateFirst(best, found - first);
+          return;
+        }
+      }
+    });
+  return first + best.load();
+}
+
+template <typename It, typename T>
+It ParallelFind(ThreadPool& pool, It first, It last, const T& value)
+{
+  return ParallelFindIf(pool, first, last, [&value](const auto& x) { return x == value; });
+}
+
+// First occurrence of [sfirst, slast) in [first, last), like `std::search()`: each block covers
+// a range of start positions, and may read up to `slast - sfirst - 1` elements past its end
+template <typename It, typename SIt>
+It ParallelSearch(ThreadPool& pool, It first, It last, SIt sfirst, SIt slast)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::ptrdiff_t m = std::distance(sfirst, slast);
+  if (m == 0)
+  {
+    return first;
+  }
+  if (m > n)
+  {
+    return last;
+  }
+  const std::ptrdiff_t starts = n - m + 1;
+  const std::size_t chunks = ParallelChunkCount(pool, starts);
+  std::atomic<std::ptrdiff_t> best{ n };
+  pool.run(chunks, [&](std::size_t i)
+    {
+      std::ptrdiff_t end = ParallelChunkBegin(i + 1, chunks, starts);
+      for (std::ptrdiff_t b = ParallelChunkBegin(i, chunks, starts); b < end; b += ParallelBlock)
+      {
+        if (best.load(std::memory_order_relaxed) < b)
+        {
+          return;
+        }
+        std::ptrdiff_t e = std::min(b + ParallelBlock, end);
+        It found = std::search(first + b, first + e + m - 1, sfirst, slast);
+        if (found != first + e + m - 1)
+        {
+          ParallelUpdateFirst(best, found - first);
+          return;
+        }
+      }
+    });
+  return first + best.load();
+}
@@ -0,0 +1,107 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::count;
+using std::count_if;
+using std::all_of;
+using std::any_of;
+using std::none_of;
+using std::find;
+using std::find_if;
+using std::search;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <thread>
+using std::thread;
+#include "ParallelAlgorithms.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ParallelCountFind [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000'000;
+
+  // Same vector as `Count.cpp`
+  ThreadPool pool;
+  vector<int> small{ 2,7,1,6,2,-2,4,0 };
+  cout << " twos in { 2,7,1,6,2,-2,4,0 }: " << ParallelCount(pool, begin(small), end(small), 2) << "\n\n";
+
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> dist(0, 999);
+  vector<int> v(n);
+  for (auto& x : v)
+  {
+    x = dist(gen);
+  }
+  v[n / 4 * 3] = -1; // the only negative number, 3/4 of the way in
+  vector<int> subsequence{ 1000, 1000 };
+  v[n / 10 * 9] = 1000; // the only occurrence of `subsequence` (or of 1000), 9/10 of the way in
+  v[n / 10 * 9 + 1] = 1000;
+  auto isEven = [](int x) { return x % 2 == 0; };
+  auto isNegative = [](int x) { return x < 0; };
+
+  // The sequential results, which the parallel ones must match
+  long long twos = 0;
+  long long evens = 0;
+  bool anyTooLarge = false;
+  bool allInRange = false;
+  bool noneNegative = false;
+  size_t firstMinusOne = 0;
+  size_t firstNegative = 0;
+  size_t firstSubsequence = 0;
+  double countMs = TimeMs([&]() { twos = count(begin(v), end(v), 2); });
+  double countIfMs = TimeMs([&]() { evens = count_if(begin(v), end(v), isEven); });
+  double anyOfMs = TimeMs([&]() { anyTooLarge = any_of(begin(v), end(v), [](int x) { return x > 1000; }); });
+  double allOfMs = TimeMs([&]() { allInRange = all_of(begin(v), end(v), [](int x) { return x <= 1000; }); });
+  double noneOfMs = TimeMs([&]() { noneNegative = none_of(begin(v), end(v), isNegative); });
+  double findMs = TimeMs([&]() { firstMinusOne = find(begin(v), end(v), -1) - begin(v); });
+  double findIfMs = TimeMs([&]() { firstNegative = find_if(begin(v), end(v), isNegative) - begin(v); });
+  double searchMs = TimeMs([&]() { firstSubsequence = search(begin(v), end(v), begin(subsequence), end(subsequence)) - begin(v); });
+  cout << ' ' << n << " ints\n sequential:\tcount " << countMs << " ms, count_if " << countIfMs << " ms, any_of "
+       << anyOfMs << " ms, all_of " << allOfMs << " ms, none_of " << noneOfMs << " ms, find " << findMs
+       << " ms, find_if " << findIfMs << " ms, search " << searchMs << " ms\n";
+
+  bool ok = true;
+  vector<unsigned> threadCounts{ 1, 2, 4, 8 };
+  if (thread::hardware_concurrency() > 8)
+  {
+    threadCounts.push_back(thread::hardware_concurrency());
+  }
+  for (unsigned threads : threadCounts)
+  {
+    ThreadPool workers(threads);
+    bool match = true;
+    countMs = TimeMs([&]() { match = ParallelCount(workers, begin(v), end(v), 2) == twos && match; });
+    countIfMs = TimeMs([&]() { match = ParallelCountIf(workers, begin(v), end(v), isEven) == evens && match; });
+    anyOfMs = TimeMs([&]() { match = ParallelAnyOf(workers, begin(v), end(v), [](int x) { return x > 1000; }) == anyTooLarge && match; });
+    allOfMs = TimeMs([&]() { match = ParallelAllOf(workers, begin(v), end(v), [](int x) { return x <= 1000; }) == allInRange && match; });
+    noneOfMs = TimeMs([&]() { match = ParallelNoneOf(workers, begin(v), end(v), isNegative) == noneNegative && match; });
+    findMs = TimeMs([&]() { match = size_t(ParallelFind(workers, begin(v), end(v), -1) - begin(v)) == firstMinusOne && match; });
+    findIfMs = TimeMs([&]() { match = size_t(ParallelFindIf(workers, begin(v), end(v), isNegative) - begin(v)) == firstNegative && match; });
+    searchMs = TimeMs([&]() { match = size_t(ParallelSearch(workers, begin(v), end(v), begin(subsequence), end(subsequence)) - begin(v)) == firstSubsequence && match; });
+    cout << ' ' << threads << " thread(s):\tcount " << countMs << " ms, count_if " << countIfMs << " ms, any_of "
+         << anyOfMs << " ms, all_of " << allOfMs << " ms, none_of " << noneOfMs << " ms, find " << findMs
+         << " ms, find_if " << findIfMs << " ms, search " << searchMs << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}
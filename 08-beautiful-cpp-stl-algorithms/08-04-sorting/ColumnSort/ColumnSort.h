@@ -0,0 +1,216 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "EmployeeTable.h"
+
+// Sorting an `EmployeeTable` by several columns at once, e.g., { { Column::Salary, Direction::Ascending },
+// { Column::LastName, Direction::Ascending } } -- the same order as `sort()` by name followed by
+// `stable_sort()` by salary, but in a single sort:
+//   1. each row gets a 128-bit composite key: the columns in order of precedence, each mapped to
+//      bits that compare (as unsigned integers) like the column does: 32 bits per salary, the first
+//      8 characters of a name, and all bits inverted for a descending column
+//   2. the (key, row) records are radix sorted (LSD, 16 bits per pass, skipping the passes in
+//      which all records have the same digit)
+//   3. if the key doesn't capture every column exactly (a name longer than its 8 characters, or
+//      columns that don't fit in 128 bits), runs of records with equal keys are sorted by the
+//      remaining columns
+// Rows that compare equal on every column keep their original order (the sort is stable)
+
+enum class Column { FirstName, LastName, Salary };
+enum class Direction { Ascending, Descending };
+
+struct SortSpec
+{
+  Column column;
+  Direction direction;
+};
+
+struct ColumnSortRecord
+{
+  std::uint64_t hi = 0;
+  std::uint64_t lo = 0;
+  std::uint32_t row = 0;
+};
+
+// Packs `width` bits (the top bits of `value`) into the key below the `used` bits already in it
+inline void AppendKeyBits(ColumnSortRecord& r, std::uint64_t value, int width, int used)
+{
+  value >>= 64 - width;
+  value <<= 64 - width; // `width` significant bits at the top
+  if (used < 64)
+  {
+    r.hi |= value >> used;
+    if (used + width > 64)
+    {
+      r.lo |= value << (64 - used);
+    }
+  }
+  else
+  {
+    r.lo |= value >> (used - 64);
+  }
+}
+
+// The first 8 characters of `s`, big-endian, zero padded
+inline std::uint64_t NamePrefix(const std::string& s)
+{
+  std::uint64_t key = 0;
+  for (std::size_t i = 0; i < 8; i++)
+  {
+    key = (key << 8) | (i < s.size() ? static_cast<unsigned char>(s[i]) : 0u);
+  }
+  return key;
+}
+
+// < for rows `a` and `b` by the specs [first, specs.size())
+inline bool RowLess(const EmployeeTable& table, const std::vector<SortSpec>& specs, std::size_t first, std::uint32_t a, std::uint32_t b)
+{
+  for (std::size_t i = first; i < specs.size(); i++)
+  {
+    int c = 0;
+    switch (specs[i].column)
+    {
+    case Column::FirstName: c = table.firstnames[a].compare(table.firstnames[b]); break;
+    case Column::LastName: c = table.lastnames[a].compare(table.lastnames[b]); break;
+    case Column::Salary: c = table.salaries[a] < table.salaries[b] ? -1 : table.salaries[a] > table.salaries[b] ? 1 : 0; break;
+    }
+    if (c != 0)
+    {
+      return specs[i].direction == Direction::Ascending ? c < 0 : c > 0;
+    }
+  }
+  return false;
+}
+
+inline void RadixSortRecords(std::vector<ColumnSortRecord>& records)
+{
+  std::vector<ColumnSortRecord> buffer(records.size());
+  for (int pass = 0; pass < 8; pass++) // least significant digit first: lo, then hi
+  {
+    auto digit = [pass](const ColumnSortRecord& r)
+      {
+        std::uint64_t word = pass < 4 ? r.lo : r.hi;
+        return static_cast<std::size_t>((word >> (16 * (pass % 4))) & 0xFFFF);
+      };
+    std::vector<std::size_t> counts(1 << 16, 0);
+    for (const auto& r : records)
+    {
+      counts[digit(r)]++;
+    }
+    if (!records.empty() && counts[digit(records[0])] == records.size())
+    {
+      continue; // every record has the same digit: nothing to do
+    }
+    std::size_t offset = 0;
+    for (auto& c : counts)
+    {
+      std::size_t count = c;
+      c = offset;
+      offset += count;
+    }
+    for (const auto& r : records)
+    {
+      buffer[counts[digit(r)]++] = r;
+    }
+    records.swap(buffer);
+  }
+}
+
+// Row indices of `table` in sorted order
+inline std::vector<std::uint32_t> ColumnSortOrder(const EmployeeTable& table, const std::vector<SortSpec>& specs)
+{
+  const std::size_t n = table.size();
+  std::vector<ColumnSortRecord> records(n);
+  for (std::size_t row = 0; row < n; row++)
+  {
+    records[row].row = static_cast<std::uint32_t>(row);
+  }
+
+  // Build the keys, one column at a time (column by column reads each column sequentially)
+  int used = 0;
+  std::size_t inexact = specs.size(); // the first spec the keys don't capture exactly
+  for (std::size_t i = 0; i < specs.size(); i++)
+  {
+    if (used == 128)
+    {
+      inexact = i; // no room left
+      break;
+    }
+    const bool isName = specs[i].column != Column::Salary;
+    const int bits = isName ? 64 : 32;
+    const int width = std::min(bits, 128 - used);
+    const std::uint64_t flip = specs[i].direction == Direction::Descending ? ~std::uint64_t{ 0 } : 0;
+    for (std::size_t row = 0; row < n; row++)
+    {
+      std::uint64_t value;
+      if (isName)
+      {
+        value = NamePrefix(specs[i].column == Column::FirstName ? table.firstnames[row] : table.lastnames[row]);
+      }
+      else
+      {
+        // flipping the sign bit orders negative salaries first, as unsigned integers
+        value = static_cast<std::uint64_t>(static_cast<std::uint32_t>(table.salaries[row]) ^ 0x80000000u) << 32;
+      }
+      AppendKeyBits(records[row], value ^ flip, width, used);
+    }
+    used += width;
+    if (isName || width < bits)
+    {
+      inexact = i; // names may continue past their prefix
+      break;
+    }
+  }
+
+  RadixSortRecords(records);
+
+  // Runs of equal keys: order by the columns the keys don't (fully) capture
+  if (inexact < specs.size())
+  {
+    for (std::size_t begin = 0; begin < n; )
+    {
+      std::size_t end = begin + 1;
+      while (end < n && records[end].hi == records[begin].hi && records[end].lo == records[begin].lo)
+      {
+        end++;
+      }
+      if (end - begin > 1)
+      {
+        std::stable_sort(records.begin() + static_cast<std::ptrdiff_t>(begin), records.begin() + static_cast<std::ptrdiff_t>(end),
+          [&](const ColumnSortRecord& a, const ColumnSortRecord& b) { return RowLess(table, specs, inexact, a.row, b.row); });
+      }
+      begin = end;
+    }
+  }
+
+  std::vector<std::uint32_t> order(n);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    order[i] = records[i].row;
+  }
+  return order;
+}
+
+template <typename T>
+void ApplyColumnOrder(std::vector<T>& column, const std::vector<std::uint32_t>& order)
+{
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (auto row : order)
+  {
+    sorted.push_back(std::move(column[row]));
+  }
+  column.swap(sorted);
+}
+
+inline void ColumnSort(EmployeeTable& table, const std::vector<SortSpec>& specs)
+{
+  auto order = ColumnSortOrder(table, specs);
+  ApplyColumnOrder(table.firstnames, order);
+  ApplyColumnOrder(table.lastnames, order);
+  ApplyColumnOrder(table.salaries, order);
+}
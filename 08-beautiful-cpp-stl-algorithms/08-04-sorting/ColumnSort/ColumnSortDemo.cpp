@@ -0,0 +1,139 @@
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include <algorithm>
+using std::sort;
+using std::stable_sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdint>
+using std::uint32_t;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <numeric>
+using std::iota;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include "Employee.h"
+#include "ColumnSort.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+EmployeeTable RandomTable(size_t n, mt19937& gen, int lowestSalary)
+{
+  const vector<string> firstnames{ "Kate", "Alan", "Grace", "Anita", "Ada", "Edsger", "Barbara", "Donald", "Frances", "Niklaus" };
+  uniform_int_distribution<int> letter('a', 'c'); // few letters: many shared prefixes
+  uniform_int_distribution<int> length(1, 12);
+  uniform_int_distribution<int> salary(lowestSalary, 200);
+  uniform_int_distribution<size_t> pick(0, firstnames.size() - 1);
+  EmployeeTable table;
+  for (size_t i = 0; i < n; i++)
+  {
+    string last(static_cast<size_t>(length(gen)), ' ');
+    for (auto& c : last)
+    {
+      c = static_cast<char>(letter(gen));
+    }
+    table.push_back(firstnames[pick(gen)], last, salary(gen) * 100);
+  }
+  return table;
+}
+
+// ColumnSortOrder() vs. `std::stable_sort()` of the row indices, comparing the columns directly
+bool CheckAgainstStableSort(mt19937& gen)
+{
+  const vector<vector<SortSpec>> specLists{
+    { { Column::Salary, Direction::Ascending }, { Column::LastName, Direction::Ascending }, { Column::FirstName, Direction::Ascending } },
+    { { Column::Salary, Direction::Descending }, { Column::FirstName, Direction::Ascending } },
+    { { Column::LastName, Direction::Descending }, { Column::Salary, Direction::Ascending } },
+    { { Column::FirstName, Direction::Ascending }, { Column::LastName, Direction::Descending }, { Column::Salary, Direction::Descending } },
+    { { Column::Salary, Direction::Ascending }, { Column::Salary, Direction::Descending }, { Column::Salary, Direction::Ascending },
+      { Column::Salary, Direction::Ascending }, { Column::LastName, Direction::Ascending } },
+  };
+  for (int trial = 0; trial < 200; trial++)
+  {
+    EmployeeTable table = RandomTable(static_cast<size_t>(trial) * 10, gen, -200);
+    for (const auto& specs : specLists)
+    {
+      vector<uint32_t> expected(table.size());
+      iota(begin(expected), end(expected), 0u);
+      stable_sort(begin(expected), end(expected), [&](uint32_t a, uint32_t b) { return RowLess(table, specs, 0, a, b); });
+      if (ColumnSortOrder(table, specs) != expected)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ColumnSortDemo [employees]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  // Same employees and order as `StableSort.cpp`: by salary, ties by name -- in one sort
+  EmployeeTable staff;
+  staff.push_back("Kate", "Gregory", 1000);
+  staff.push_back("Obvious", "Artificial", 2000);
+  staff.push_back("Fake", "Name", 1000);
+  staff.push_back("Alan", "Turing", 2000);
+  staff.push_back("Grace", "Hopper", 2000);
+  staff.push_back("Anita", "Borg", 2000);
+  const vector<SortSpec> bySalaryThenName{
+    { Column::Salary, Direction::Ascending }, { Column::LastName, Direction::Ascending }, { Column::FirstName, Direction::Ascending } };
+  ColumnSort(staff, bySalaryThenName);
+  for (size_t row = 0; row < staff.size(); row++)
+  {
+    cout << ' ' << staff.getSortingName(row) << " (" << staff.salaries[row] << ")\n";
+  }
+
+  mt19937 gen{ 1846 };
+  bool ok = CheckAgainstStableSort(gen);
+  if (!ok)
+  {
+    cout << " MISMATCH against std::stable_sort()!\n";
+  }
+
+  EmployeeTable table = RandomTable(n, gen, 10);
+  vector<Employee> employees;
+  employees.reserve(n);
+  for (size_t row = 0; row < n; row++)
+  {
+    employees.emplace_back(table.firstnames[row], table.lastnames[row], table.salaries[row]);
+  }
+  cout << "\n " << n << " employees, by salary, then by name:\n";
+
+  double twoPassMs = TimeMs([&]()
+    {
+      sort(begin(employees), end(employees),
+        [](const Employee& e1, const Employee& e2) {return e1.getSortingName() < e2.getSortingName(); });
+      stable_sort(begin(employees), end(employees),
+        [](const Employee& e1, const Employee& e2) {return e1.getSalary() < e2.getSalary(); });
+    });
+  double columnMs = TimeMs([&]() { ColumnSort(table, bySalaryThenName); });
+
+  bool match = true;
+  for (size_t row = 0; row < n; row++)
+  {
+    match = match && employees[row].getSalary() == table.salaries[row] && employees[row].getSortingName() == table.getSortingName(row);
+  }
+  cout << "\tsort() + stable_sort() of vector<Employee>: " << twoPassMs << " ms\n\tColumnSort() of EmployeeTable: "
+       << columnMs << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+
+  return ok && match ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The same data as a `vector<Employee>`, stored column by column ("structure of arrays"):
+// a sort that only looks at salaries reads just the `salaries` column
+class EmployeeTable
+{
+public:
+  void push_back(std::string first, std::string last, int sal)
+  {
+    firstnames.push_back(std::move(first));
+    lastnames.push_back(std::move(last));
+    salaries.push_back(sal);
+  }
+
+  std::size_t size() const { return salaries.size(); }
+  std::string getSortingName(std::size_t row) const { return lastnames[row] + ", " + firstnames[row]; }
+
+  std::vector<std::string> firstnames;
+  std::vector<std::string> lastnames;
+  std::vector<int> salaries;
+};
@@ -0,0 +1,201 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// A sorted array re-laid in Eytzinger (breadth-first) order, for `lower_bound()`/`upper_bound()`
+// searches that are kinder to the cache than a binary search of the sorted array
+//   * node k (1-based) has its children at 2k and 2k + 1, so a search just walks k = 2k + (go right),
+//     without branches; the first levels of the tree, which every search visits, share a few
+//     cache lines
+//   * the B descendants log2(B) levels below node k are adjacent (Bk ... Bk + B - 1), so a search
+//     prefetches them while it's still deciding the levels in between; B is the largest power of
+//     two with B elements in a 64-byte line (e.g., 16 for 4-byte elements, so four levels ahead),
+//     and the nodes are stored from a line boundary, so for element sizes that divide 64 those B
+//     descendants are exactly one cache line
+//   * `lowerBoundIndices()` runs a batch of searches in lockstep, so the cache misses of several
+//     searches overlap
+// The results are indices into the original sorted order, as `lower_bound(...) - begin(v)`
+
+template <typename T, typename Compare = std::less<>>
+class EytzingerArray
+{
+public:
+  // [first, last) must be sorted by `comp`
+  template <typename It>
+  EytzingerArray(It first, It last, Compare comp = {}) : n(static_cast<std::size_t>(std::distance(first, last))), comp(comp)
+  {
+    for (levels = 0; (std::size_t{ 2 } << levels) - 1 <= n; levels++)
+    {
+    }
+    lastLevelSize = n - ((std::size_t{ 1 } << levels) - 1);
+    // 1-based, in raw storage starting at a cache line: node 0 (never constructed) only pads
+    tree = static_cast<T*>(::operator new((n + 1) * sizeof(T), std::align_val_t{ CacheLine }));
+    std::size_t constructed = 0;
+    try
+    {
+      fill(first, 1, constructed);
+    }
+    catch (...)
+    {
+      destroy(constructed);
+      throw;
+    }
+  }
+
+  ~EytzingerArray()
+  {
+    destroy(n);
+  }
+
+  EytzingerArray(const EytzingerArray&) = delete;
+  EytzingerArray& operator=(const EytzingerArray&) = delete;
+
+  std::size_t size() const { return n; }
+
+  // Same as `lower_bound(begin(v), end(v), x, comp) - begin(v)` for the sorted original v
+  std::size_t lowerBoundIndex(const T& x) const
+  {
+    return search(x, [this](const T& node, const T& key) { return comp(node, key); });
+  }
+
+  // Same as `upper_bound(begin(v), end(v), x, comp) - begin(v)`
+  std::size_t upperBoundIndex(const T& x) const
+  {
+    return search(x, [this](const T& node, const T& key) { return !comp(key, node); });
+  }
+
+  // `lowerBoundIndex()` of each of the queries [first, last), written to `out`
+  template <typename It, typename OutIt>
+  OutIt lowerBoundIndices(It first, It last, OutIt out) const
+  {
+    std::size_t k[Batch];
+    const T* queries[Batch];
+    while (first != last)
+    {
+      std::size_t count = 0;
+      for (; count < Batch && first != last; ++first)
+      {
+        queries[count] = std::addressof(*first);
+        k[count++] = 1;
+      }
+      // Every search goes down the complete levels...
+      for (std::size_t level = 0; level < levels; level++)
+      {
+        for (std::size_t j = 0; j < count; j++)
+        {
+          prefetch(k[j]);
+          k[j] = 2 * k[j] + (comp(tree[k[j]], *queries[j]) ? 1 : 0);
+        }
+      }
+      // ...and some go one level further
+      for (std::size_t j = 0; j < count; j++)
+      {
+        if (k[j] <= n)
+        {
+          k[j] = 2 * k[j] + (comp(tree[k[j]], *queries[j]) ? 1 : 0);
+        }
+        *out = sortedIndex(k[j]);
+        ++out;
+      }
+    }
+    return out;
+  }
+
+private:
+  static constexpr std::size_t CacheLine = 64;
+  static constexpr std::size_t Batch = 16;
+
+  // Largest power of two of elements that fit in a cache line (at least 1)
+  static constexpr std::size_t DescendantsPerLine()
+  {
+    std::size_t b = 1;
+    while (2 * b * sizeof(T) <= CacheLine)
+    {
+      b *= 2;
+    }
+    return b;
+  }
+
+  static constexpr std::size_t PrefetchAhead = DescendantsPerLine();
+
+  // In-order traversal of the tree, constructing the nodes from the sorted elements in turn
+  template <typename It>
+  It fill(It it, std::size_t k, std::size_t& constructed)
+  {
+    if (k <= n)
+    {
+      it = fill(it, 2 * k, constructed);
+      ::new (static_cast<void*>(tree + k)) T(*it);
+      constructed++;
+      ++it;
+      it = fill(it, 2 * k + 1, constructed);
+    }
+    return it;
+  }
+
+  // Destroys the nodes of the first `count` sorted elements, and frees the storage
+  void destroy(std::size_t count)
+  {
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+      for (std::size_t k = 1; k <= n; k++)
+      {
+        if (count == n || nodeRank(k) < count)
+        {
+          tree[k].~T();
+        }
+      }
+    }
+    ::operator delete(tree, std::align_val_t{ CacheLine });
+  }
+
+  void prefetch(std::size_t k) const
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(tree + std::min(k * PrefetchAhead, n));
+#endif
+  }
+
+  template <typename GoRight>
+  std::size_t search(const T& x, GoRight goRight) const
+  {
+    std::size_t k = 1;
+    while (k <= n)
+    {
+      prefetch(k);
+      k = 2 * k + (goRight(tree[k], x) ? 1 : 0);
+    }
+    return sortedIndex(k);
+  }
+
+  // Past the end of a search, k holds the path taken: the answer is the last node where the
+  // search went left (strip the trailing 1s, and the 0 before them), or none (`n`)
+  std::size_t sortedIndex(std::size_t k) const
+  {
+    k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+    return k == 0 ? n : nodeRank(k);
+  }
+
+  // Index in the sorted order of the element at node k (1 <= k <= n)
+  std::size_t nodeRank(std::size_t k) const
+  {
+    // In-order rank of node k in the perfect tree of levels + 1 levels, less the leaves that are
+    // missing before it (the last level is filled from the left)
+    std::size_t depth = static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(k)));
+    std::size_t rank = ((2 * (k - (std::size_t{ 1 } << depth)) + 1) << (levels - depth)) - 1;
+    std::size_t leavesBefore = (rank + 1) / 2;
+    return rank - (leavesBefore > lastLevelSize ? leavesBefore - lastLevelSize : 0);
+  }
+
+  std::size_t n;
+  Compare comp;
+  T* tree = nullptr; // `n + 1` elements' worth, node 0 unused
+  std::size_t levels = 0;        // complete levels
+  std::size_t lastLevelSize = 0; // nodes in the partial level below them
+};
@@ -0,0 +1,153 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::lower_bound;
+using std::upper_bound;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+using std::to_string;
+#include "Eytzinger.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Every lower and upper bound of small arrays with duplicates, including values past both ends
+bool Validate(mt19937& gen)
+{
+  for (size_t n = 0; n <= 300; n++)
+  {
+    uniform_int_distribution<int> dist(0, static_cast<int>(n / 2));
+    vector<int> v(n);
+    for (auto& x : v)
+    {
+      x = dist(gen);
+    }
+    std::sort(begin(v), end(v));
+    EytzingerArray<int> e(begin(v), end(v));
+    vector<int> queries;
+    for (int x = -1; x <= static_cast<int>(n / 2) + 1; x++)
+    {
+      queries.push_back(x);
+    }
+    vector<size_t> batch(queries.size());
+    e.lowerBoundIndices(begin(queries), end(queries), begin(batch));
+    for (size_t i = 0; i < queries.size(); i++)
+    {
+      int x = queries[i];
+      size_t lower = static_cast<size_t>(lower_bound(begin(v), end(v), x) - begin(v));
+      size_t upper = static_cast<size_t>(upper_bound(begin(v), end(v), x) - begin(v));
+      if (e.lowerBoundIndex(x) != lower || batch[i] != lower || e.upperBoundIndex(x) != upper)
+      {
+        cout << " FAILED: " << n << " elements, query " << x << '\n';
+        return false;
+      }
+    }
+  }
+  // Non-trivial elements whose size doesn't divide a cache line
+  for (size_t n = 0; n <= 300; n++)
+  {
+    vector<string> v(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      v[i] = "element #" + to_string(100'000 + 2 * i) + " with a heap-allocated name";
+    }
+    EytzingerArray<string> e(begin(v), end(v));
+    for (size_t i = 0; i <= 2 * n; i++)
+    {
+      string x = "element #" + to_string(100'000 + i - 1) + " with a heap-allocated name";
+      if (e.lowerBoundIndex(x) != static_cast<size_t>(lower_bound(begin(v), end(v), x) - begin(v))
+        || e.upperBoundIndex(x) != static_cast<size_t>(upper_bound(begin(v), end(v), x) - begin(v)))
+      {
+        cout << " FAILED: " << n << " strings, query " << x << '\n';
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: EytzingerSearchDemo [largest array in bytes] -- from 16KB (L1) up to the largest (default 1GB)
+  size_t largest = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : size_t{ 1 } << 30;
+
+  // Same search as `MinMaxFind.cpp`
+  vector<int> v2{ -9,-6,-2,0,0,0,1,1,2,3,4,7,9 };
+  EytzingerArray<int> e2(begin(v2), end(v2));
+  cout << " first positive number in v2: " << v2[e2.upperBoundIndex(0)] << "\n\n";
+
+  mt19937 gen{ 1846 };
+  bool ok = Validate(gen);
+  cout << " validation " << (ok ? "passed" : "FAILED") << "\n\n";
+
+  const size_t queryCount = 1 << 20;
+  for (size_t bytes = 1 << 14; bytes <= largest; bytes *= 4)
+  {
+    // Sorted values with random gaps, queries anywhere in their range
+    size_t n = bytes / sizeof(int);
+    vector<int> v(n);
+    uniform_int_distribution<int> gap(0, 3);
+    int value = 0;
+    for (auto& x : v)
+    {
+      x = value += gap(gen);
+    }
+    uniform_int_distribution<int> dist(-1, value + 1);
+    vector<int> queries(queryCount);
+    for (auto& q : queries)
+    {
+      q = dist(gen);
+    }
+
+    vector<size_t> expected(queryCount);
+    vector<size_t> single(queryCount);
+    vector<size_t> batch(queryCount);
+    double stdMs = TimeMs([&]()
+      {
+        for (size_t i = 0; i < queryCount; i++)
+        {
+          expected[i] = static_cast<size_t>(lower_bound(begin(v), end(v), queries[i]) - begin(v));
+        }
+      });
+    double buildMs = 0.0;
+    double singleMs = 0.0;
+    double batchMs = 0.0;
+    {
+      std::unique_ptr<EytzingerArray<int>> e;
+      buildMs = TimeMs([&]() { e = std::make_unique<EytzingerArray<int>>(begin(v), end(v)); });
+      singleMs = TimeMs([&]()
+        {
+          for (size_t i = 0; i < queryCount; i++)
+          {
+            single[i] = e->lowerBoundIndex(queries[i]);
+          }
+        });
+      batchMs = TimeMs([&]() { e->lowerBoundIndices(begin(queries), end(queries), begin(batch)); });
+    }
+    bool match = single == expected && batch == expected;
+    cout << ' ' << (bytes >> 10) << " KB, " << queryCount << " queries: std::lower_bound() " << stdMs << " ms, Eytzinger "
+         << singleMs << " ms, batched " << batchMs << " ms (speedup " << stdMs / batchMs << "x; built in " << buildMs << " ms)"
+         << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::is_sorted;
+using std::is_sorted_until;
+using std::sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdint>
+using std::int64_t;
+using std::uint32_t;
+#include <cstdlib>
+using std::atoll;
+#include <functional>
+using std::greater;
+#include <iostream>
+using std::cout;
+#include <limits>
+using std::numeric_limits;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+using std::to_string;
+#include "IsSorted.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// One element out of order at every position in turn (and none), for each size; both ascending
+// and, via `std::greater<>` (i.e., not vectorized), descending
+template <typename T>
+bool Validate(ThreadPool& pool)
+{
+  for (size_t n : { 0, 1, 2, 33, 64, 65, 66, 200, 140'000 })
+  {
+    vector<T> v(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      v[i] = static_cast<T>(i / 3); // with ties
+    }
+    size_t step = n > 1000 ? 997 : 1;
+    for (size_t broken = 0; broken <= n; broken += step)
+    {
+      auto w = v;
+      if (broken < n)
+      {
+        w[broken] = numeric_limits<T>::lowest();
+      }
+      auto expected = is_sorted_until(begin(w), end(w));
+      if (FastIsSortedUntil(begin(w), end(w)) != expected || ParallelIsSortedUntil(pool, begin(w), end(w)) != expected
+        || FastIsSortedUntil(w.data(), w.data() + n) != w.data() + (expected - begin(w))
+        || ParallelIsSorted(pool, begin(w), end(w)) != (expected == end(w)))
+      {
+        cout << " FAILED: " << n << " elements, broken at " << broken << '\n';
+        return false;
+      }
+      std::reverse(begin(w), end(w));
+      if (ParallelIsSortedUntil(pool, begin(w), end(w), greater<>{}) != is_sorted_until(begin(w), end(w), greater<>{}))
+      {
+        cout << " FAILED: " << n << " elements, descending, broken at " << broken << '\n';
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+bool Benchmark(const string& what, const vector<T>& v, size_t broken)
+{
+  const T* p = v.data();
+  size_t expected = 0;
+  size_t fast = 0;
+  double stdMs = TimeMs([&]() { expected = static_cast<size_t>(is_sorted_until(p, p + v.size()) - p); });
+  double fastMs = TimeMs([&]() { fast = static_cast<size_t>(FastIsSortedUntil(begin(v), end(v)) - begin(v)); });
+  bool ok = expected == fast && expected == broken;
+  cout << ' ' << what << ": std::is_sorted_until() " << stdMs << " ms, FastIsSortedUntil() " << fastMs << " ms";
+  for (unsigned threads : { 1, 2, 4, 8 })
+  {
+    ThreadPool pool(threads);
+    size_t parallel = 0;
+    bool sorted = false;
+    double ms = TimeMs([&]() { parallel = static_cast<size_t>(ParallelIsSortedUntil(pool, begin(v), end(v)) - begin(v)); });
+    double sortedMs = TimeMs([&]() { sorted = ParallelIsSorted(pool, begin(v), end(v)); });
+    cout << ", " << threads << "T " << ms << " ms (ParallelIsSorted() " << sortedMs << " ms)";
+    ok = ok && parallel == expected && sorted == (expected == v.size());
+  }
+  cout << (ok ? "" : " -- MISMATCH!") << '\n';
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: FastIsSortedDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000'000;
+
+  // Same vector as `IsSorted.cpp`
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  auto v2 = v;
+  auto byMagnitude = [](int elem1, int elem2) { return abs(elem1) > abs(elem2); };
+  sort(begin(v2), end(v2), byMagnitude);
+  cout << std::boolalpha << " is v2 sorted? " << FastIsSorted(begin(v2), end(v2)) << ", by decreasing magnitude? "
+       << FastIsSorted(begin(v2), end(v2), byMagnitude) << "\n\n";
+
+  ThreadPool pool(3);
+  bool ok = Validate<int>(pool) && Validate<uint32_t>(pool) && Validate<int64_t>(pool) && Validate<float>(pool)
+    && Validate<double>(pool) && Validate<short>(pool);
+  cout << " validation " << (ok ? "passed" : "FAILED") << "\n\n " << n << " elements:\n";
+
+  vector<int> ints(n);
+  vector<double> doubles(n);
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> gap(0, 1);
+  int value = numeric_limits<int>::min();
+  for (size_t i = 0; i < n; i++)
+  {
+    ints[i] = value += gap(gen);
+    doubles[i] = static_cast<double>(ints[i]) / 3.0;
+  }
+  ok = Benchmark("int, sorted     ", ints, n) && ok;
+  ok = Benchmark("double, sorted  ", doubles, n) && ok;
+  // Out of order near the end: a parallel check finds it about as fast as a full one...
+  size_t late = n - n / 10;
+  ints[late] = numeric_limits<int>::min();
+  ok = Benchmark("int, at 90%     ", ints, late) && ok;
+  ints[late] = ints[late - 1];
+  // ...and near the start, every thread stops early
+  size_t early = n / 10;
+  ints[early] = numeric_limits<int>::min();
+  ok = Benchmark("int, at 10%     ", ints, early) && ok;
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "ThreadPool.h"
+
+// `is_sorted()` and `is_sorted_until()` for very large ranges (e.g., checking that a multi-GB
+// column is still sorted)
+//   * for contiguous ranges of `int32_t`, `uint32_t`, `int64_t`, `float` and `double` in ascending
+//     order (`std::less`), each element is compared with its successor a whole AVX2 register at a
+//     time: two overlapping loads, one compare, and four registers' results are combined before a
+//     single branch; other ranges use `std::is_sorted_until()`
+//   * the `Parallel...()` versions check chunks on a `ThreadPool`; in `ParallelIsSorted()`, every
+//     thread stops as soon as any finds an element out of order; in `ParallelIsSortedUntil()`, a
+//     thread that finds one records its position, and the others stop as soon as they only have
+//     positions after that one left to check
+
+#if defined(__AVX2__)
+// The AVX2 operations per element type (none for other types): bit i of `outOfOrder()` is set iff
+// next[i] < current[i]
+template <typename T>
+struct SortedLanes
+{
+};
+
+template <>
+struct SortedLanes<std::int32_t>
+{
+  static constexpr std::size_t Count = 8;
+  static unsigned outOfOrder(const std::int32_t* p)
+  {
+    __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(current, next))));
+  }
+};
+
+template <>
+struct SortedLanes<std::uint32_t>
+{
+  static constexpr std::size_t Count = 8;
+  static unsigned outOfOrder(const std::uint32_t* p)
+  {
+    // Unsigned order is signed order with the sign bits flipped
+    const __m256i flip = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+    __m256i current = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), flip);
+    __m256i next = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1)), flip);
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(current, next))));
+  }
+};
+
+template <>
+struct SortedLanes<std::int64_t>
+{
+  static constexpr std::size_t Count = 4;
+  static unsigned outOfOrder(const std::int64_t* p)
+  {
+    __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(current, next))));
+  }
+};
+
+template <>
+struct SortedLanes<float>
+{
+  static constexpr std::size_t Count = 8;
+  static unsigned outOfOrder(const float* p)
+  {
+    // Ordered compare: false for NaNs, the same as `<` in `std::is_sorted()`
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + 1), _mm256_loadu_ps(p), _CMP_LT_OQ)));
+  }
+};
+
+template <>
+struct SortedLanes<double>
+{
+  static constexpr std::size_t Count = 4;
+  static unsigned outOfOrder(const double* p)
+  {
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(p + 1), _mm256_loadu_pd(p), _CMP_LT_OQ)));
+  }
+};
+
+template <typename T, typename = void>
+constexpr bool HasSortedLanes = false;
+
+template <typename T>
+constexpr bool HasSortedLanes<T, std::void_t<decltype(SortedLanes<T>::Count)>> = true;
+#else
+template <typename T>
+constexpr bool HasSortedLanes = false;
+#endif
+
+// Same as `is_sorted_until(p, p + n) - p`: the index of the first element smaller than the one
+// before it, or `n`
+template <typename T>
+std::size_t SortedPrefixLength(const T* p, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  if constexpr (HasSortedLanes<T>)
+  {
+    using Lanes = SortedLanes<T>;
+    constexpr std::size_t Count = Lanes::Count;
+    // Pairs (p[i + j], p[i + j + 1]) for j < 4 * Count
+    for (; i + 4 * Count + 1 <= n; i += 4 * Count)
+    {
+      unsigned m0 = Lanes::outOfOrder(p + i);
+      unsigned m1 = Lanes::outOfOrder(p + i + Count);
+      unsigned m2 = Lanes::outOfOrder(p + i + 2 * Count);
+      unsigned m3 = Lanes::outOfOrder(p + i + 3 * Count);
+      if ((m0 | m1 | m2 | m3) != 0)
+      {
+        std::uint64_t mask = std::uint64_t{ m0 } | (std::uint64_t{ m1 } << Count) | (std::uint64_t{ m2 } << (2 * Count))
+          | (std::uint64_t{ m3 } << (3 * Count));
+        return i + static_cast<std::size_t>(__builtin_ctzll(mask)) + 1;
+      }
+    }
+  }
+#endif
+  return i + static_cast<std::size_t>(std::is_sorted_until(p + i, p + n) - (p + i));
+}
+
+template <typename It, typename Compare>
+constexpr bool CanCheckSortedLanes()
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  if constexpr (!HasSortedLanes<T>)
+  {
+    return false;
+  }
+  else
+  {
+    return (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>)
+      && (std::is_pointer_v<It> || std::is_same_v<It, typename std::vector<T>::iterator> || std::is_same_v<It, typename std::vector<T>::const_iterator>);
+  }
+}
+
+// Same as `std::is_sorted_until(first, last, comp)`
+template <typename It, typename Compare = std::less<>>
+It FastIsSortedUntil(It first, It last, Compare comp = {})
+{
+  if constexpr (CanCheckSortedLanes<It, Compare>())
+  {
+    if (first == last)
+    {
+      return last;
+    }
+    return first + static_cast<std::ptrdiff_t>(SortedPrefixLength(std::addressof(*first), static_cast<std::size_t>(last - first)));
+  }
+  else
+  {
+    return std::is_sorted_until(first, last, comp);
+  }
+}
+
+template <typename It, typename Compare = std::less<>>
+bool FastIsSorted(It first, It last, Compare comp = {})
+{
+  return FastIsSortedUntil(first, last, comp) == last;
+}
+
+const std::ptrdiff_t SortedCheckMinChunk = 1 << 16; // smaller ranges aren't worth a thread
+const std::ptrdiff_t SortedCheckBlock = 1 << 16;    // elements between early-exit checks
+
+// Number of chunks to split `n` elements into for `pool`, 1 if not worth splitting
+inline std::size_t SortedCheckChunks(const ThreadPool& pool, std::ptrdiff_t n)
+{
+  return static_cast<std::size_t>(std::max<std::ptrdiff_t>(1, std::min<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(pool.size()) * 4, n / SortedCheckMinChunk)));
+}
+
+// Start offset of chunk `i` of `chunks` over `n` elements
+inline std::ptrdiff_t SortedCheckChunkBegin(std::size_t i, std::size_t chunks, std::ptrdiff_t n)
+{
+  return static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(chunks));
+}
+
+// Same as `std::is_sorted_until(first, last, comp)`, for random access ranges
+// Each block also checks the first element of the next one, so no pair is missed at the seams;
+// threads keep checking the positions before the first violation found so far, in case there's
+// an earlier one
+template <typename It, typename Compare = std::less<>>
+It ParallelIsSortedUntil(ThreadPool& pool, It first, It last, Compare comp = {})
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = SortedCheckChunks(pool, n);
+  if (chunks == 1)
+  {
+    return FastIsSortedUntil(first, last, comp);
+  }
+  std::atomic<std::ptrdiff_t> best{ n };
+  pool.run(chunks, [&](std::size_t i)
+    {
+      std::ptrdiff_t end = SortedCheckChunkBegin(i + 1, chunks, n);
+      for (std::ptrdiff_t b = SortedCheckChunkBegin(i, chunks, n); b < end; b += SortedCheckBlock)
+      {
+        if (best.load(std::memory_order_relaxed) <= b)
+        {
+          return; // an earlier element is already known to be out of order
+        }
+        It e = first + std::min(b + SortedCheckBlock + 1, n);
+        It found = FastIsSortedUntil(first + b, e, comp);
+        if (found != e)
+        {
+          std::ptrdiff_t pos = found - first;
+          std::ptrdiff_t current = best.load(std::memory_order_relaxed);
+          while (pos < current && !best.compare_exchange_weak(current, pos, std::memory_order_relaxed))
+          {
+          }
+          return;
+        }
+      }
+    });
+  return first + best.load();
+}
+
+// Same as `std::is_sorted(first, last, comp)`: any violation settles it, so all threads stop at
+// their next block once one has been found, wherever it is
+template <typename It, typename Compare = std::less<>>
+bool ParallelIsSorted(ThreadPool& pool, It first, It last, Compare comp = {})
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = SortedCheckChunks(pool, n);
+  if (chunks == 1)
+  {
+    return FastIsSorted(first, last, comp);
+  }
+  std::atomic<bool> outOfOrder{ false };
+  pool.run(chunks, [&](std::size_t i)
+    {
+      std::ptrdiff_t end = SortedCheckChunkBegin(i + 1, chunks, n);
+      for (std::ptrdiff_t b = SortedCheckChunkBegin(i, chunks, n); b < end && !outOfOrder.load(std::memory_order_relaxed); b += SortedCheckBlock)
+      {
+        It e = first + std::min(b + SortedCheckBlock + 1, n);
+        if (FastIsSortedUntil(first + b, e, comp) != e)
+        {
+          outOfOrder.store(true, std::memory_order_relaxed);
+        }
+      }
+    });
+  return !outOfOrder.load();
+}
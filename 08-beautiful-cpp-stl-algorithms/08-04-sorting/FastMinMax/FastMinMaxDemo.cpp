@@ -0,0 +1,132 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::max_element;
+using std::min_element;
+using std::minmax_element;
+using std::sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdint>
+using std::int64_t;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+#include <string>
+using std::string;
+#include "MinMax.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Same values and (first) indices as `min_element()` and `max_element()`
+template <typename T>
+bool Matches(const MinMaxResult<T>& r, const vector<T>& v)
+{
+  if (v.empty())
+  {
+    return r.minIndex == 0 && r.maxIndex == 0;
+  }
+  auto low = min_element(begin(v), end(v));
+  auto high = max_element(begin(v), end(v));
+  return r.min == *low && r.max == *high && r.minIndex == static_cast<size_t>(low - begin(v))
+    && r.maxIndex == static_cast<size_t>(high - begin(v));
+}
+
+template <typename T>
+bool Validate(ThreadPool& pool, mt19937& gen)
+{
+  for (size_t n : { 0, 1, 7, 8, 9, 31, 1000, 1'000'003 })
+  {
+    for (int values : { 1, 5, 1'000'000 }) // many ties to none
+    {
+      uniform_int_distribution<int> dist(-values, values);
+      vector<T> v(n);
+      for (auto& x : v)
+      {
+        x = static_cast<T>(dist(gen));
+      }
+      if (!Matches(MinMax(v), v) || !Matches(ParallelMinMax(pool, v), v))
+      {
+        cout << " FAILED: " << n << " elements, " << values << " values\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+size_t Checksum = 0; // keeps the results of the Standard Library calls alive
+
+template <typename T>
+bool Benchmark(const string& what, ThreadPool& pool, const vector<T>& v)
+{
+  double twoPassMs = TimeMs([&]() { Checksum += static_cast<size_t>((min_element(begin(v), end(v)) - begin(v)) + (max_element(begin(v), end(v)) - begin(v))); });
+  double stdMs = TimeMs([&]()
+    {
+      auto [low, high] = minmax_element(begin(v), end(v));
+      Checksum += static_cast<size_t>((low - begin(v)) + (high - begin(v)));
+    });
+  MinMaxResult<T> single;
+  MinMaxResult<T> parallel;
+  double singleMs = TimeMs([&]() { single = MinMax(v); });
+  double parallelMs = TimeMs([&]() { parallel = ParallelMinMax(pool, v); });
+  auto sorted = v;
+  double sortMs = TimeMs([&]() { sort(begin(sorted), end(sorted)); });
+  bool ok = Matches(single, v) && Matches(parallel, v) && single.min == sorted.front() && single.max == sorted.back();
+  cout << ' ' << what << ": min_element() + max_element() " << twoPassMs << " ms, minmax_element() " << stdMs << " ms, MinMax() "
+       << singleMs << " ms, ParallelMinMax() (" << pool.size() << " thread(s)) " << parallelMs << " ms, sort() " << sortMs << " ms"
+       << (ok ? "" : " -- MISMATCH!") << '\n';
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: FastMinMaxDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 20'000'000;
+
+  // Same vector as `MinMaxFind.cpp`
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  auto r = MinMax(v);
+  cout << " v: smallest " << r.min << " (at " << r.minIndex << "), largest " << r.max << " (at " << r.maxIndex << ")\n\n";
+
+  ThreadPool pool;
+  mt19937 gen{ 1846 };
+  bool ok = Validate<int>(pool, gen) && Validate<float>(pool, gen) && Validate<double>(pool, gen) && Validate<int64_t>(pool, gen)
+    && Validate<short>(pool, gen);
+  cout << " validation " << (ok ? "passed" : "FAILED") << "\n\n " << n << " elements:\n";
+
+  uniform_int_distribution<int> ints;
+  uniform_real_distribution<double> reals(-1e6, 1e6);
+  vector<int> a(n);
+  vector<float> b(n);
+  vector<double> c(n);
+  vector<int64_t> d(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    a[i] = ints(gen);
+    b[i] = static_cast<float>(reals(gen));
+    c[i] = reals(gen);
+    d[i] = static_cast<int64_t>(ints(gen)) * ints(gen);
+  }
+  ok = Benchmark("int    ", pool, a) && ok;
+  ok = Benchmark("float  ", pool, b) && ok;
+  ok = Benchmark("double ", pool, c) && ok;
+  ok = Benchmark("int64_t", pool, d) && ok;
+
+  return ok ? 0 : 1;
+}
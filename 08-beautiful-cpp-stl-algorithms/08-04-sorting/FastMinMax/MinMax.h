@@ -0,0 +1,240 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "ThreadPool.h"
+
+// The smallest and largest values of an arithmetic array and their *first* positions, in one pass
+// (as `min_element()` and `max_element()` would give -- N.B. `minmax_element()` gives the *last*
+// largest one)
+// Each SIMD lane keeps its own running minimum and maximum, plus the index where it found each,
+// updated by compare-and-blend (strictly smaller/larger only, so a lane keeps its first index);
+// the lanes are combined at the end, ties going to the smallest index
+//   * AVX2: `int32_t` and `float` 8 at a time, `double` 4 at a time; other types (and builds
+//     without AVX2) use a plain one-pass loop
+//   * `ParallelMinMax()` splits huge arrays across a `ThreadPool`
+// Floating-point arrays must not contain NaNs
+
+template <typename T>
+struct MinMaxResult
+{
+  T min{};
+  T max{};
+  std::size_t minIndex = 0; // `n` for an empty array
+  std::size_t maxIndex = 0;
+};
+
+// Merges the results for two neighboring pieces: `b` starts `offset` elements after `a`'s start
+template <typename T>
+MinMaxResult<T> CombineMinMax(MinMaxResult<T> a, const MinMaxResult<T>& b, std::size_t offset)
+{
+  if (b.min < a.min)
+  {
+    a.min = b.min;
+    a.minIndex = offset + b.minIndex;
+  }
+  if (a.max < b.max)
+  {
+    a.max = b.max;
+    a.maxIndex = offset + b.maxIndex;
+  }
+  return a;
+}
+
+// p[0, n), n > 0
+template <typename T>
+MinMaxResult<T> ScalarMinMax(const T* p, std::size_t n)
+{
+  MinMaxResult<T> result{ p[0], p[0], 0, 0 };
+  for (std::size_t i = 1; i < n; i++)
+  {
+    if (p[i] < result.min)
+    {
+      result.min = p[i];
+      result.minIndex = i;
+    }
+    if (result.max < p[i])
+    {
+      result.max = p[i];
+      result.maxIndex = i;
+    }
+  }
+  return result;
+}
+
+#if defined(__AVX2__)
+// The AVX2 operations per element type (none for other types)
+template <typename T>
+struct MinMaxLanes
+{
+};
+
+template <>
+struct MinMaxLanes<std::int32_t>
+{
+  using Vector = __m256i;
+  static constexpr std::size_t Count = 8;
+  static Vector load(const std::int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+  static __m256i less(Vector a, Vector b) { return _mm256_cmpgt_epi32(b, a); }
+  static Vector blend(Vector a, Vector b, __m256i mask) { return _mm256_blendv_epi8(a, b, mask); }
+  static __m256i firstIndices() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+  static __m256i step() { return _mm256_set1_epi32(8); }
+  static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+};
+
+template <>
+struct MinMaxLanes<float>
+{
+  using Vector = __m256;
+  static constexpr std::size_t Count = 8;
+  static Vector load(const float* p) { return _mm256_loadu_ps(p); }
+  static __m256i less(Vector a, Vector b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+  static Vector blend(Vector a, Vector b, __m256i mask) { return _mm256_blendv_ps(a, b, _mm256_castsi256_ps(mask)); }
+  static __m256i firstIndices() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+  static __m256i step() { return _mm256_set1_epi32(8); }
+  static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+};
+
+template <>
+struct MinMaxLanes<double>
+{
+  using Vector = __m256d;
+  static constexpr std::size_t Count = 4;
+  static Vector load(const double* p) { return _mm256_loadu_pd(p); }
+  static __m256i less(Vector a, Vector b) { return _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+  static Vector blend(Vector a, Vector b, __m256i mask) { return _mm256_blendv_pd(a, b, _mm256_castsi256_pd(mask)); }
+  static __m256i firstIndices() { return _mm256_setr_epi64x(0, 1, 2, 3); }
+  static __m256i step() { return _mm256_set1_epi64x(4); }
+  static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi64(a, b); }
+};
+
+template <typename T, typename = void>
+constexpr bool HasMinMaxLanes = false;
+
+template <typename T>
+constexpr bool HasMinMaxLanes<T, std::void_t<decltype(MinMaxLanes<T>::Count)>> = true;
+
+// p[0, n), Count <= n <= MinMaxBlock
+template <typename T>
+MinMaxResult<T> SimdMinMax(const T* p, std::size_t n)
+{
+  using Lanes = MinMaxLanes<T>;
+  using Vector = typename Lanes::Vector;
+  using Index = std::conditional_t<Lanes::Count == 8, std::int32_t, std::int64_t>;
+  constexpr std::size_t Count = Lanes::Count;
+
+  Vector minimum = Lanes::load(p);
+  Vector maximum = minimum;
+  __m256i minIndex = Lanes::firstIndices();
+  __m256i maxIndex = minIndex;
+  __m256i index = minIndex;
+  const __m256i step = Lanes::step();
+  std::size_t i = Count;
+  for (; i + Count <= n; i += Count)
+  {
+    index = Lanes::add(index, step);
+    Vector x = Lanes::load(p + i);
+    __m256i smaller = Lanes::less(x, minimum);
+    __m256i larger = Lanes::less(maximum, x);
+    minimum = Lanes::blend(minimum, x, smaller);
+    minIndex = _mm256_blendv_epi8(minIndex, index, smaller);
+    maximum = Lanes::blend(maximum, x, larger);
+    maxIndex = _mm256_blendv_epi8(maxIndex, index, larger);
+  }
+
+  alignas(32) T minimums[Count];
+  alignas(32) T maximums[Count];
+  alignas(32) Index minIndices[Count];
+  alignas(32) Index maxIndices[Count];
+  std::memcpy(minimums, &minimum, sizeof(minimums));
+  std::memcpy(maximums, &maximum, sizeof(maximums));
+  _mm256_store_si256(reinterpret_cast<__m256i*>(minIndices), minIndex);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(maxIndices), maxIndex);
+  MinMaxResult<T> result{ minimums[0], maximums[0], static_cast<std::size_t>(minIndices[0]), static_cast<std::size_t>(maxIndices[0]) };
+  for (std::size_t lane = 1; lane < Count; lane++)
+  {
+    auto laneMin = static_cast<std::size_t>(minIndices[lane]);
+    if (minimums[lane] < result.min || (minimums[lane] == result.min && laneMin < result.minIndex))
+    {
+      result.min = minimums[lane];
+      result.minIndex = laneMin;
+    }
+    auto laneMax = static_cast<std::size_t>(maxIndices[lane]);
+    if (result.max < maximums[lane] || (maximums[lane] == result.max && laneMax < result.maxIndex))
+    {
+      result.max = maximums[lane];
+      result.maxIndex = laneMax;
+    }
+  }
+  return i == n ? result : CombineMinMax(result, ScalarMinMax(p + i, n - i), i);
+}
+#endif
+
+// Longest piece whose lane indices fit in 32 bits
+const std::size_t MinMaxBlock = std::size_t{ 1 } << 30;
+
+// Same values as `*min_element(p, p + n)` and `*max_element(p, p + n)`, and their indices
+template <typename T>
+MinMaxResult<T> MinMax(const T* p, std::size_t n)
+{
+  static_assert(std::is_arithmetic_v<T>, "MinMax() is for arithmetic types");
+  if (n == 0)
+  {
+    return { T{}, T{}, 0, 0 };
+  }
+#if defined(__AVX2__)
+  if constexpr (HasMinMaxLanes<T>)
+  {
+    if (n >= MinMaxLanes<T>::Count)
+    {
+      MinMaxResult<T> result = SimdMinMax(p, std::min(n, MinMaxBlock));
+      for (std::size_t offset = MinMaxBlock; offset < n; offset += MinMaxBlock)
+      {
+        result = CombineMinMax(result, SimdMinMax(p + offset, std::min(n - offset, MinMaxBlock)), offset);
+      }
+      return result;
+    }
+  }
+#endif
+  return ScalarMinMax(p, n);
+}
+
+template <typename T>
+MinMaxResult<T> MinMax(const std::vector<T>& v)
+{
+  return MinMax(v.data(), v.size());
+}
+
+const std::size_t MinMaxMinPart = std::size_t{ 1 } << 18; // smallest part worth a task
+
+// Same as `MinMax()`, with parts of the array on different threads
+template <typename T>
+MinMaxResult<T> ParallelMinMax(ThreadPool& pool, const T* p, std::size_t n)
+{
+  const std::size_t parts = std::max<std::size_t>(1, std::min<std::size_t>(pool.size() * 4, n / MinMaxMinPart));
+  if (parts == 1)
+  {
+    return MinMax(p, n);
+  }
+  auto bound = [&](std::size_t i) { return static_cast<std::size_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(parts)); };
+  std::vector<MinMaxResult<T>> results(parts);
+  pool.run(parts, [&](std::size_t i) { results[i] = MinMax(p + bound(i), bound(i + 1) - bound(i)); });
+  MinMaxResult<T> result = results[0];
+  for (std::size_t i = 1; i < parts; i++)
+  {
+    result = CombineMinMax(result, results[i], bound(i)); // in order: ties keep the first index
+  }
+  return result;
+}
+
+template <typename T>
+MinMaxResult<T> ParallelMinMax(ThreadPool& pool, const std::vector<T>& v)
+{
+  return ParallelMinMax(pool, v.data(), v.size());
+}
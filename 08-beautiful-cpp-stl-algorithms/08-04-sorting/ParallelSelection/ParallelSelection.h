@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "ThreadPool.h"
+
+// `nth_element()` and `partial_sort_copy()` (top-k) on a `ThreadPool`
+//   * ParallelNthElement() -- sample select: a sorted sample of the current range gives two
+//     pivots that bracket the n-th element closely; two parallel partitions then narrow the range
+//     down to the elements between them (a few percent), until it is small enough for
+//     `std::nth_element()`
+//   * ParallelPartialSortCopy() -- each thread keeps a heap of the k smallest elements of its own
+//     part; the heaps are merged (and sorted) at the end
+// ParallelNthElement() only allocates the sample; ParallelPartialSortCopy() holds up to k elements
+// per part, twice (heaps, then merged), so when that's more than half the range it uses
+// `std::partial_sort_copy()` instead
+
+const std::ptrdiff_t SelectMinPart = 1 << 16;     // smallest part worth a task
+const std::ptrdiff_t SelectSampleSize = 4096;
+const std::ptrdiff_t SelectSampleMargin = 64;     // pivots are this many sample ranks around n
+
+inline std::size_t SelectPartCount(ThreadPool& pool, std::ptrdiff_t n)
+{
+  return static_cast<std::size_t>(std::max<std::ptrdiff_t>(1, std::min<std::ptrdiff_t>(pool.size(), n / SelectMinPart)));
+}
+
+// Same as `std::partition(first, last, pred)` (not stable)
+// Each part is partitioned on its own; the elements that are then on the wrong side of the
+// overall split point (as many falses before it as trues after it) are swapped in parallel
+template <typename It, typename Pred>
+It ParallelPartition(ThreadPool& pool, It first, It last, Pred pred)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t parts = SelectPartCount(pool, n);
+  if (parts == 1)
+  {
+    return std::partition(first, last, pred);
+  }
+  auto bound = [&](std::size_t i) { return static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(parts)); };
+  std::vector<std::ptrdiff_t> split(parts);
+  pool.run(parts, [&](std::size_t i)
+    {
+      split[i] = std::partition(first + bound(i), first + bound(i + 1), pred) - first;
+    });
+  std::ptrdiff_t trues = 0;
+  for (std::size_t i = 0; i < parts; i++)
+  {
+    trues += split[i] - bound(i);
+  }
+
+  // Misplaced elements, as lists of ranges: falses before `trues`, and trues from `trues` on
+  struct Ranges
+  {
+    std::vector<std::ptrdiff_t> begin;
+    std::vector<std::ptrdiff_t> start{ 0 }; // number of elements in the preceding ranges
+    void add(std::ptrdiff_t b, std::ptrdiff_t e)
+    {
+      if (b < e)
+      {
+        begin.push_back(b);
+        start.push_back(start.back() + e - b);
+      }
+    }
+    std::size_t find(std::ptrdiff_t k) const
+    {
+      return static_cast<std::size_t>(std::upper_bound(start.begin(), start.end(), k) - start.begin()) - 1;
+    }
+  };
+  Ranges falses;
+  Ranges truesAfter;
+  for (std::size_t i = 0; i < parts; i++)
+  {
+    falses.add(split[i], std::min(bound(i + 1), trues));
+    truesAfter.add(std::max(bound(i), trues), split[i]);
+  }
+  const std::ptrdiff_t misplaced = falses.start.back();
+  pool.run(parts, [&](std::size_t t)
+    {
+      std::ptrdiff_t k = misplaced * static_cast<std::ptrdiff_t>(t) / static_cast<std::ptrdiff_t>(parts);
+      const std::ptrdiff_t kEnd = misplaced * static_cast<std::ptrdiff_t>(t + 1) / static_cast<std::ptrdiff_t>(parts);
+      std::size_t a = falses.find(k);
+      std::size_t b = truesAfter.find(k);
+      while (k < kEnd)
+      {
+        std::ptrdiff_t aLeft = falses.start[a + 1] - k;
+        std::ptrdiff_t bLeft = truesAfter.start[b + 1] - k;
+        std::ptrdiff_t count = std::min({ aLeft, bLeft, kEnd - k });
+        It from = first + falses.begin[a] + (k - falses.start[a]);
+        std::swap_ranges(from, from + count, first + truesAfter.begin[b] + (k - truesAfter.start[b]));
+        k += count;
+        a += count == aLeft ? 1 : 0;
+        b += count == bLeft ? 1 : 0;
+      }
+    });
+  return first + trues;
+}
+
+// Same as `std::nth_element(first, nth, last, comp)`
+template <typename It, typename Compare = std::less<>>
+void ParallelNthElement(ThreadPool& pool, It first, It nth, It last, Compare comp = {})
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  std::uint64_t seed = 0x9E3779B97F4A7C15; // fixed: the same pivots on every run
+  std::vector<T> sample;
+  while (last - first > SelectMinPart && SelectPartCount(pool, last - first) > 1 && nth != last)
+  {
+    const std::ptrdiff_t n = last - first;
+    sample.clear();
+    for (std::ptrdiff_t i = 0; i < SelectSampleSize; i++)
+    {
+      seed = seed * 6364136223846793005 + 1442695040888963407; // LCG, using the high bits
+      sample.push_back(first[static_cast<std::ptrdiff_t>((seed >> 32) % static_cast<std::uint64_t>(n))]);
+    }
+    std::sort(sample.begin(), sample.end(), comp);
+    const std::ptrdiff_t rank = (nth - first) * SelectSampleSize / n;
+    const T& low = sample[static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, rank - SelectSampleMargin))];
+    const T& high = sample[static_cast<std::size_t>(std::min(SelectSampleSize - 1, rank + SelectSampleMargin))];
+
+    // [first, last) becomes [< low | low..high | > high]
+    It lowEnd = ParallelPartition(pool, first, last, [&](const T& x) { return comp(x, low); });
+    if (nth < lowEnd)
+    {
+      last = lowEnd;
+      continue;
+    }
+    It highBegin = ParallelPartition(pool, lowEnd, last, [&](const T& x) { return !comp(high, x); });
+    if (nth >= highBegin)
+    {
+      first = highBegin;
+      continue;
+    }
+    if (!comp(low, high))
+    {
+      return; // low..high is a run of equal elements, so n is already in place
+    }
+    first = lowEnd;
+    last = highBegin;
+    if (last - first > n / 2)
+    {
+      break; // too many duplicates of the pivots to narrow this down quickly
+    }
+  }
+  std::nth_element(first, nth, last, comp);
+}
+
+// Same as `std::partial_sort_copy(first, last, dFirst, dLast, comp)`: the k = min(last - first,
+// dLast - dFirst) smallest elements, sorted, into [dFirst, dFirst + k)
+template <typename It, typename OutIt, typename Compare = std::less<>>
+OutIt ParallelPartialSortCopy(ThreadPool& pool, It first, It last, OutIt dFirst, OutIt dLast, Compare comp = {})
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  const std::ptrdiff_t n = last - first;
+  const std::ptrdiff_t k = std::min<std::ptrdiff_t>(n, dLast - dFirst);
+  if (k == 0)
+  {
+    return dFirst;
+  }
+  const std::size_t parts = SelectPartCount(pool, n);
+  if (parts == 1 || k > n / 2 / static_cast<std::ptrdiff_t>(parts))
+  {
+    return std::partial_sort_copy(first, last, dFirst, dLast, comp);
+  }
+
+  // Each part: a max-heap (by `comp`) of its k smallest elements so far
+  std::vector<std::vector<T>> heaps(parts);
+  pool.run(parts, [&](std::size_t i)
+    {
+      It begin = first + static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(parts));
+      It end = first + static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i + 1) / static_cast<double>(parts));
+      std::vector<T>& heap = heaps[i];
+      It filled = begin + std::min(k, end - begin);
+      heap.assign(begin, filled);
+      std::make_heap(heap.begin(), heap.end(), comp);
+      for (It it = filled; it != end; ++it)
+      {
+        if (comp(*it, heap.front())) // usually false once the heap holds small elements
+        {
+          std::pop_heap(heap.begin(), heap.end(), comp);
+          heap.back() = *it;
+          std::push_heap(heap.begin(), heap.end(), comp);
+        }
+      }
+    });
+
+  std::vector<T> candidates;
+  for (auto& heap : heaps)
+  {
+    candidates.insert(candidates.end(), std::make_move_iterator(heap.begin()), std::make_move_iterator(heap.end()));
+  }
+  std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comp);
+  std::sort(candidates.begin(), candidates.begin() + k, comp);
+  return std::move(candidates.begin(), candidates.begin() + k, dFirst);
+}
+
+// The k smallest elements of [first, last), sorted
+template <typename It, typename Compare = std::less<>>
+std::vector<typename std::iterator_traits<It>::value_type> ParallelTopK(ThreadPool& pool, It first, It last, std::size_t k, Compare comp = {})
+{
+  std::vector<typename std::iterator_traits<It>::value_type> result(std::min(k, static_cast<std::size_t>(last - first)));
+  ParallelPartialSortCopy(pool, first, last, result.begin(), result.end(), comp);
+  return result;
+}
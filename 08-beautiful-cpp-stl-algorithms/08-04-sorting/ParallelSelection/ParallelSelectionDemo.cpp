@@ -0,0 +1,152 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::is_partitioned;
+using std::nth_element;
+using std::partial_sort_copy;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include "ParallelSelection.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Whether v is partitioned around v[nth] as by `nth_element()`, with the expected value there
+bool CheckNth(const vector<int>& v, size_t nth, int expected)
+{
+  int x = v[nth];
+  return x == expected
+    && is_partitioned(begin(v), begin(v) + static_cast<std::ptrdiff_t>(nth), [x](int y) { return y <= x; })
+    && std::all_of(begin(v), begin(v) + static_cast<std::ptrdiff_t>(nth), [x](int y) { return y <= x; })
+    && std::all_of(begin(v) + static_cast<std::ptrdiff_t>(nth), end(v), [x](int y) { return y >= x; });
+}
+
+bool Validate(mt19937& gen)
+{
+  for (unsigned threads : { 1, 2, 3, 8 })
+  {
+    ThreadPool pool(threads);
+    for (size_t n : { 1, 2, 1000, 65'537, 300'001, 2'000'000 })
+    {
+      for (int values : { 1, 3, 1000, 1'000'000'000 }) // all duplicates to none
+      {
+        uniform_int_distribution<int> dist(0, values - 1);
+        vector<int> original(n);
+        for (auto& x : original)
+        {
+          x = dist(gen);
+        }
+        auto sorted = original;
+        std::sort(begin(sorted), end(sorted));
+        for (size_t nth : { size_t{ 0 }, n / 3, n / 2, n - 1 })
+        {
+          auto v = original;
+          ParallelNthElement(pool, begin(v), begin(v) + static_cast<std::ptrdiff_t>(nth), end(v));
+          if (!CheckNth(v, nth, sorted[nth]))
+          {
+            cout << " FAILED: ParallelNthElement(), " << n << " elements, " << values << " values, nth " << nth << '\n';
+            return false;
+          }
+        }
+        for (size_t k : { size_t{ 1 }, size_t{ 100 }, n / 20, n / 3, n, n + 5 })
+        {
+          vector<int> top(k, -1);
+          auto topEnd = ParallelPartialSortCopy(pool, begin(original), end(original), begin(top), end(top));
+          size_t count = std::min(k, n);
+          if (topEnd != begin(top) + static_cast<std::ptrdiff_t>(count) || !std::equal(begin(top), topEnd, begin(sorted)))
+          {
+            cout << " FAILED: ParallelPartialSortCopy(), " << n << " elements, " << values << " values, k " << k << '\n';
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ParallelSelectionDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000'000;
+
+  // Same vectors as `NthElement.cpp` and `PartialSorting.cpp`
+  ThreadPool pool;
+  vector<int> v2 = { 1,5,4,2,9,7,3,8,2 };
+  ParallelNthElement(pool, begin(v2), begin(v2) + 4, end(v2));
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  vector<int> v3(3);
+  ParallelPartialSortCopy(pool, begin(v), end(v), begin(v3), end(v3));
+  cout << " median of v2: " << v2[4] << "\n 3 smallest of v:";
+  for (int x : v3)
+  {
+    cout << ' ' << x;
+  }
+  cout << "\n\n";
+
+  mt19937 gen{ 1846 };
+  bool ok = Validate(gen);
+  cout << " validation " << (ok ? "passed" : "FAILED") << "\n\n";
+
+  uniform_int_distribution<int> dist;
+  vector<int> original(n);
+  for (auto& x : original)
+  {
+    x = dist(gen);
+  }
+  cout << ' ' << n << " ints\n";
+
+  // Median and 99th percentile
+  for (size_t nth : { n / 2, n / 100 * 99 })
+  {
+    auto expected = original;
+    double stdMs = TimeMs([&]() { nth_element(begin(expected), begin(expected) + static_cast<std::ptrdiff_t>(nth), end(expected)); });
+    cout << " nth_element(" << nth << "):\t\tstd " << stdMs << " ms";
+    for (unsigned threads : { 1, 2, 4, 8 })
+    {
+      ThreadPool workers(threads);
+      auto w = original;
+      double ms = TimeMs([&]() { ParallelNthElement(workers, begin(w), begin(w) + static_cast<std::ptrdiff_t>(nth), end(w)); });
+      bool match = CheckNth(w, nth, expected[nth]);
+      cout << ", " << threads << "T " << ms << " ms" << (match ? "" : " -- MISMATCH!");
+      ok = ok && match;
+    }
+    cout << '\n';
+  }
+
+  // Top-k
+  for (size_t k : { 100, 10'000, 1'000'000 })
+  {
+    vector<int> expected(k);
+    double stdMs = TimeMs([&]() { partial_sort_copy(begin(original), end(original), begin(expected), end(expected)); });
+    cout << " partial_sort_copy(k = " << k << "):\tstd " << stdMs << " ms";
+    for (unsigned threads : { 1, 2, 4, 8 })
+    {
+      ThreadPool workers(threads);
+      vector<int> top(k);
+      double ms = TimeMs([&]() { ParallelPartialSortCopy(workers, begin(original), end(original), begin(top), end(top)); });
+      bool match = top == expected;
+      cout << ", " << threads << "T " << ms << " ms" << (match ? "" : " -- MISMATCH!");
+      ok = ok && match;
+    }
+    cout << '\n';
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Philox.h"
+#include "ThreadPool.h"
+
+// A parallel `shuffle()`: MergeShuffle (Bacher, Bodini, Hollender, Nicaud, "MergeShuffle: A Very
+// Fast, Parallel Random Permutation Algorithm", 2015)
+//   1. the range is cut into blocks (a power of two of them, at most `blockSize` elements each),
+//      which are Fisher-Yates shuffled concurrently
+//   2. neighboring shuffled blocks are merged level by level (the merges of a level run
+//      concurrently): a coin flip per position picks which of the two goes there, and once
+//      either runs out, the rest are inserted at random positions, which makes the result a
+//      uniformly random permutation again
+// Each block and each merge draws from its own Philox stream (derived from the seed and its
+// position), so the result depends only on the seed and the size -- not on the number of threads
+// The merges stream through memory rather than swapping with random positions all over the
+// range, which is what makes Fisher-Yates slow for ranges much larger than the cache
+
+const std::ptrdiff_t ShuffleBlock = 1 << 16;
+
+// Fisher-Yates shuffle of [first, last)
+template <typename It>
+void FisherYatesShuffle(It first, It last, Philox4x32& gen)
+{
+  for (std::ptrdiff_t i = (last - first) - 1; i > 0; i--)
+  {
+    std::iter_swap(first + i, first + static_cast<std::ptrdiff_t>(RandomBelow(gen, static_cast<std::uint64_t>(i) + 1)));
+  }
+}
+
+// [first, middle) and [middle, last), each uniformly shuffled, into one uniformly shuffled range
+template <typename It>
+void MergeShuffled(It first, It middle, It last, Philox4x32& gen)
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  It i = first;
+  It j = middle;
+  while (true)
+  {
+    // Neither half can run out in the next `safe` steps, so they need no checks: for simple types,
+    // the coin flips then select values rather than branches (which would be mispredicted half
+    // the time); each random word gives 32 flips
+    for (std::ptrdiff_t safe = std::min(last - j, j - i); safe > 0; )
+    {
+      std::uint32_t bits = gen();
+      for (std::ptrdiff_t steps = std::min<std::ptrdiff_t>(32, safe); steps > 0; steps--, safe--, ++i, bits >>= 1)
+      {
+        const unsigned fromSecond = bits & 1;
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          const T pair[2] = { *i, *j }; // indexed rather than `?:`, which compilers may turn back into a branch
+          *i = pair[fromSecond];
+          *j = pair[1 - fromSecond];
+          j += fromSecond;
+        }
+        else if (fromSecond != 0)
+        {
+          std::iter_swap(i, j);
+          ++j;
+        }
+      }
+    }
+    // One step with the checks: either half may be used up
+    if ((gen() & 1) != 0)
+    {
+      if (j == last)
+      {
+        break;
+      }
+      std::iter_swap(i, j);
+      ++j;
+    }
+    else if (i == j)
+    {
+      break;
+    }
+    ++i;
+  }
+  // The rest (of whichever half is left) go into random positions
+  for (; i != last; ++i)
+  {
+    std::iter_swap(i, first + static_cast<std::ptrdiff_t>(RandomBelow(gen, static_cast<std::uint64_t>(i - first) + 1)));
+  }
+}
+
+// Same effect as `std::shuffle(first, last, gen)`, reproducible from `seed`
+template <typename It>
+void ParallelShuffle(ThreadPool& pool, It first, It last, std::uint64_t seed, std::ptrdiff_t blockSize = ShuffleBlock)
+{
+  const std::ptrdiff_t n = last - first;
+  if (n < 2)
+  {
+    return;
+  }
+  // A power of two of (nearly) equal blocks, so each merge is of two (nearly) equal halves: the
+  // random insertions at the end of a merge are then only a few, rather than most of the longer half
+  std::size_t blocks = 1;
+  while ((n + static_cast<std::ptrdiff_t>(blocks) - 1) / static_cast<std::ptrdiff_t>(blocks) > blockSize)
+  {
+    blocks *= 2;
+  }
+  auto bound = [&](std::size_t i) { return first + n * static_cast<std::ptrdiff_t>(i) / static_cast<std::ptrdiff_t>(blocks); };
+  pool.run(blocks, [&](std::size_t i)
+    {
+      Philox4x32 gen(seed, i);
+      FisherYatesShuffle(bound(i), bound(i + 1), gen);
+    });
+
+  // Streams for the merges: the level in the upper bits, the merge's index in the lower ones
+  std::uint64_t level = 1;
+  for (std::size_t width = 1; width < blocks; width *= 2, level++)
+  {
+    pool.run(blocks / (2 * width), [&](std::size_t i)
+      {
+        Philox4x32 gen(seed, (level << 40) | i);
+        MergeShuffled(bound(2 * i * width), bound((2 * i + 1) * width), bound((2 * i + 2) * width), gen);
+      });
+  }
+}
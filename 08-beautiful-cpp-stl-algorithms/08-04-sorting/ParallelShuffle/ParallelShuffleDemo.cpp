@@ -0,0 +1,191 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::shuffle;
+using std::sort;
+#include <array>
+using std::array;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cmath>
+using std::sqrt;
+#include <cstdint>
+using std::uint32_t;
+using std::uint64_t;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <map>
+using std::map;
+#include <random>
+using std::mt19937;
+#include "ParallelShuffle.h"
+#include "Sampling.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Pearson's chi-squared statistic for `counts` against equal (or the given) expected counts,
+// compared with its mean + 5 standard deviations (the degrees of freedom, + 5 sqrt(2 dof))
+bool LooksUniform(const vector<double>& counts, const vector<double>& expected)
+{
+  double chi2 = 0.0;
+  for (size_t i = 0; i < counts.size(); i++)
+  {
+    chi2 += (counts[i] - expected[i]) * (counts[i] - expected[i]) / expected[i];
+  }
+  double dof = static_cast<double>(counts.size() - 1);
+  return chi2 < dof + 5 * sqrt(2 * dof);
+}
+
+bool Validate()
+{
+  // Known answers from the Philox authors' test vectors
+  bool ok = Philox4x32::Block({ 0, 0, 0, 0 }, { 0, 0 }) == array<uint32_t, 4>{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }
+    && Philox4x32::Block({ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff })
+      == array<uint32_t, 4>{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+  cout << " Philox4x32-10 known answers: " << (ok ? "match" : "MISMATCH!") << '\n';
+
+  // All 120 orders of 5 elements, equally often, via blocks of 2 (2 levels of merges)
+  ThreadPool pool(3);
+  map<vector<int>, double> seen;
+  const int trials = 120'000;
+  for (int t = 0; t < trials; t++)
+  {
+    vector<int> v{ 0, 1, 2, 3, 4 };
+    ParallelShuffle(pool, begin(v), end(v), static_cast<uint64_t>(t), 2);
+    seen[v]++;
+  }
+  vector<double> counts;
+  for (auto& [order, count] : seen)
+  {
+    counts.push_back(count);
+  }
+  bool uniform = counts.size() == 120 && LooksUniform(counts, vector<double>(120, trials / 120.0));
+  cout << " permutations of 5 elements equally likely: " << (uniform ? "yes" : "NO!") << '\n';
+  ok = ok && uniform;
+
+  // Same result for any number of threads; a permutation of the input
+  vector<int> original(1'000'003);
+  for (size_t i = 0; i < original.size(); i++)
+  {
+    original[i] = static_cast<int>(i);
+  }
+  vector<int> reference = original;
+  ParallelShuffle(pool, begin(reference), end(reference), 1846);
+  auto sorted = reference;
+  sort(begin(sorted), end(sorted));
+  bool reproducible = sorted == original && reference != original;
+  for (unsigned threads : { 1, 2, 8 })
+  {
+    ThreadPool workers(threads);
+    auto v = original;
+    ParallelShuffle(workers, begin(v), end(v), 1846);
+    reproducible = reproducible && v == reference;
+  }
+  cout << " same shuffle for 1 to 8 threads: " << (reproducible ? "yes" : "NO!") << '\n';
+  ok = ok && reproducible;
+
+  // Reservoir: each of 100 elements in a sample of 10 equally often
+  vector<double> picked(100);
+  for (int t = 0; t < 20'000; t++)
+  {
+    for (int x : ReservoirSample(begin(original), begin(original) + 100, 10, static_cast<uint64_t>(t)))
+    {
+      picked[static_cast<size_t>(x)]++;
+    }
+  }
+  bool reservoir = LooksUniform(picked, vector<double>(100, 2'000.0));
+  cout << " reservoir samples uniform: " << (reservoir ? "yes" : "NO!") << '\n';
+  ok = ok && reservoir;
+
+  // Weighted: single draws in proportion to weights 1, 2, 3, 4 (and never the weight-0 index)
+  vector<double> weights{ 1, 2, 0, 3, 4 };
+  vector<double> expected{ 4'000, 8'000, 1e-9, 12'000, 16'000 };
+  vector<double> drawn(5);
+  vector<double> aliased(5);
+  AliasTable table(weights);
+  Philox4x32 gen(1846);
+  for (int t = 0; t < 40'000; t++)
+  {
+    drawn[WeightedSample(pool, weights, 1, static_cast<uint64_t>(t))[0]]++;
+    aliased[table(gen)]++;
+  }
+  bool weighted = drawn[2] == 0 && aliased[2] == 0 && LooksUniform(drawn, expected) && LooksUniform(aliased, expected);
+  auto all = WeightedSample(pool, weights, 10, 1);
+  weighted = weighted && all.size() == 4;
+  cout << " weighted samples in proportion: " << (weighted ? "yes" : "NO!") << '\n';
+  return ok && weighted;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ParallelShuffleDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000'000;
+
+  // Same vector as `Shuffle.cpp` (and the same shuffle for the same seed, every time)
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  auto v2 = v;
+  sort(begin(v2), end(v2));
+  ThreadPool pool;
+  ParallelShuffle(pool, begin(v2), end(v2), 1846);
+  for (int x : v2)
+  {
+    cout << ' ' << x;
+  }
+  cout << "\n\n";
+
+  bool ok = Validate();
+  cout << '\n' << ' ' << n << " ints:\n";
+
+  vector<int> original(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    original[i] = static_cast<int>(i);
+  }
+  auto expected = original;
+  mt19937 generator(1846);
+  double stdMs = TimeMs([&]() { shuffle(begin(expected), end(expected), generator); });
+  cout << " std::shuffle() (mt19937):\t" << stdMs << " ms\n";
+  vector<int> first;
+  for (unsigned threads : { 1, 2, 4, 8 })
+  {
+    ThreadPool workers(threads);
+    auto w = original;
+    double ms = TimeMs([&]() { ParallelShuffle(workers, begin(w), end(w), 1846); });
+    if (first.empty())
+    {
+      first = w;
+    }
+    bool match = w == first;
+    cout << " ParallelShuffle(), " << threads << " thread(s):\t" << ms << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  vector<int> sample;
+  double reservoirMs = TimeMs([&]() { sample = ReservoirSample(begin(original), end(original), 1000, 1846); });
+  vector<int> stdSample(1000);
+  double stdSampleMs = TimeMs([&]() { std::sample(begin(original), end(original), begin(stdSample), 1000, generator); });
+  vector<double> weights(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    weights[i] = 1.0 + static_cast<double>(i % 10);
+  }
+  vector<size_t> weighted;
+  double weightedMs = TimeMs([&]() { weighted = WeightedSample(pool, weights, 1000, 1846); });
+  cout << " 1000 of them: ReservoirSample() " << reservoirMs << " ms, std::sample() " << stdSampleMs << " ms, WeightedSample() "
+       << weightedMs << " ms\n";
+  ok = ok && sample.size() == 1000 && weighted.size() == 1000;
+
+  return ok ? 0 : 1;
+}
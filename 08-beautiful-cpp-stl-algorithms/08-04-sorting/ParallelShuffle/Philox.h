@@ -0,0 +1,108 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", 2011): a
+// counter-based generator, i.e., its n-th output is a fixed function (10 rounds of multiplies and
+// xors) of (key, n), with no state carried from one output to the next
+//   * any number of independent streams from one seed: the stream id goes into the upper half of
+//     the counter, so e.g. each block of a parallel shuffle gets its own generator, and the
+//     result doesn't depend on which thread ran which block
+//   * same outputs on every platform and compiler (unlike `std::uniform_int_distribution`, so use
+//     `RandomBelow()` and `RandomUnit()` with it for reproducible results)
+// A UniformRandomBitGenerator, so it also works with `std::shuffle()` and the distributions
+class Philox4x32
+{
+public:
+  using result_type = std::uint32_t;
+
+  explicit Philox4x32(std::uint64_t seed, std::uint64_t stream = 0)
+    : key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) },
+      counter{ 0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) }
+  {
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()()
+  {
+    if (next == 4)
+    {
+      output = Block(counter, key);
+      next = 0;
+      if (++counter[0] == 0)
+      {
+        ++counter[1];
+      }
+    }
+    return output[next++];
+  }
+
+  std::uint64_t next64()
+  {
+    std::uint64_t high = (*this)();
+    return (high << 32) | (*this)();
+  }
+
+  // The raw function: 4 outputs for one (counter, key)
+  static std::array<std::uint32_t, 4> Block(const std::array<std::uint32_t, 4>& c, const std::array<std::uint32_t, 2>& k)
+  {
+    std::uint32_t c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3];
+    std::uint32_t k0 = k[0], k1 = k[1];
+    for (int round = 0; round < 10; round++)
+    {
+      std::uint64_t p0 = std::uint64_t{ 0xD2511F53 } * c0;
+      std::uint64_t p1 = std::uint64_t{ 0xCD9E8D57 } * c2;
+      c0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+      c2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+      c1 = static_cast<std::uint32_t>(p1);
+      c3 = static_cast<std::uint32_t>(p0);
+      k0 += 0x9E3779B9;
+      k1 += 0xBB67AE85;
+    }
+    return { c0, c1, c2, c3 };
+  }
+
+private:
+  std::array<std::uint32_t, 2> key;
+  std::array<std::uint32_t, 4> counter;
+  std::array<std::uint32_t, 4> output{};
+  int next = 4;
+};
+
+// Uniform in [0, bound), bound > 0: Lemire's multiply-and-shift (no division in the common case)
+// below 2^32, rejection of the incomplete last interval above
+template <typename Generator>
+std::uint64_t RandomBelow(Generator& gen, std::uint64_t bound)
+{
+  if (bound <= std::uint64_t{ 1 } << 32)
+  {
+    std::uint64_t product = std::uint64_t{ gen() } * bound;
+    if (static_cast<std::uint32_t>(product) < bound)
+    {
+      const std::uint32_t threshold = static_cast<std::uint32_t>((std::uint64_t{ 1 } << 32) % bound);
+      while (static_cast<std::uint32_t>(product) < threshold)
+      {
+        product = std::uint64_t{ gen() } * bound;
+      }
+    }
+    return product >> 32;
+  }
+  const std::uint64_t threshold = (0 - bound) % bound; // 2^64 mod bound
+  std::uint64_t r = gen.next64();
+  while (r < threshold)
+  {
+    r = gen.next64();
+  }
+  return r % bound;
+}
+
+// Uniform in (0, 1): 53 random bits, centered in their interval (never 0, so `log()` is safe)
+template <typename Generator>
+double RandomUnit(Generator& gen)
+{
+  return (static_cast<double>(gen.next64() >> 11) + 0.5) / 9007199254740992.0;
+}
@@ -0,0 +1,197 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Philox.h"
+#include "ThreadPool.h"
+
+// Random samples of large collections, reproducible from a seed
+//   * ReservoirSample() -- k elements, each equally likely, from a range of unknown length in one
+//     pass (Li's "Algorithm L": random jumps over the elements that won't be taken, so it draws
+//     O(k log(n/k)) random numbers rather than one per element, and skips without reading them on
+//     random-access ranges)
+//   * WeightedSample() -- k distinct indices, index i with probability proportional to weights[i]
+//     (Efraimidis-Spirakis: the k largest keys u^(1/w), with u uniform in (0, 1), found via random
+//     jumps over the weights; each part of the weights keeps its own k best on a `ThreadPool`)
+//   * AliasTable -- any number of independent draws, index i with probability proportional to
+//     weights[i] (Vose's alias method: O(n) to build, then O(1) per draw)
+
+// k elements of [first, last) (or all of them if there are fewer), in no particular order
+template <typename It>
+std::vector<typename std::iterator_traits<It>::value_type> ReservoirSample(It first, It last, std::size_t k, std::uint64_t seed)
+{
+  std::vector<typename std::iterator_traits<It>::value_type> reservoir;
+  reservoir.reserve(k);
+  for (; first != last && reservoir.size() < k; ++first)
+  {
+    reservoir.push_back(*first);
+  }
+  if (first == last || k == 0)
+  {
+    return reservoir;
+  }
+  Philox4x32 gen(seed);
+  const double kInverse = 1.0 / static_cast<double>(k);
+  double w = std::exp(std::log(RandomUnit(gen)) * kInverse);
+  while (true)
+  {
+    // Skip the elements that won't go into the reservoir, then replace a random one with the next
+    double skip = std::floor(std::log(RandomUnit(gen)) / std::log1p(-w));
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>)
+    {
+      if (skip >= static_cast<double>(last - first))
+      {
+        return reservoir;
+      }
+      first += static_cast<std::ptrdiff_t>(skip);
+    }
+    else
+    {
+      for (; skip > 0 && first != last; skip--)
+      {
+        ++first;
+      }
+      if (first == last)
+      {
+        return reservoir;
+      }
+    }
+    reservoir[RandomBelow(gen, k)] = *first;
+    ++first;
+    w *= std::exp(std::log(RandomUnit(gen)) * kInverse);
+  }
+}
+
+const std::size_t WeightedSamplePart = 1 << 16; // at least; fixed, so the sample doesn't depend on the threads
+
+// k distinct indices of `weights` (fewer if fewer weights are positive), index i with probability
+// proportional to weights[i], in decreasing order of their keys (i.e., in the order drawn)
+template <typename Weight>
+std::vector<std::size_t> WeightedSample(ThreadPool& pool, const std::vector<Weight>& weights, std::size_t k, std::uint64_t seed)
+{
+  // log(u) / w orders the same way as u^(1/w) (and doesn't underflow for small w)
+  using Entry = std::pair<double, std::size_t>;
+  auto better = [](const Entry& a, const Entry& b) { return a.first > b.first; }; // heap top: the worst key kept
+  // Parts much longer than k, or most of their elements would go into their heaps
+  const std::size_t partSize = std::max(WeightedSamplePart, 16 * k);
+  const std::size_t parts = (weights.size() + partSize - 1) / partSize;
+  std::vector<std::vector<Entry>> heaps(parts);
+  pool.run(parts, [&](std::size_t part)
+    {
+      Philox4x32 gen(seed, part);
+      std::vector<Entry>& heap = heaps[part];
+      const std::size_t end = std::min(weights.size(), (part + 1) * partSize);
+      std::size_t i = part * partSize;
+      for (; i < end && heap.size() < k; i++)
+      {
+        if (weights[i] > 0)
+        {
+          heap.push_back({ std::log(RandomUnit(gen)) / static_cast<double>(weights[i]), i });
+          std::push_heap(heap.begin(), heap.end(), better);
+        }
+      }
+      // Once the heap is full: exponential jumps (Efraimidis-Spirakis "A-ExpJ") -- a random
+      // amount of weight to skip before the next element that gets in, rather than a key for each
+      while (i < end && k > 0)
+      {
+        const double worst = heap.front().first; // log of the smallest key kept
+        double skip = std::log(RandomUnit(gen)) / worst;
+        for (; i < end && skip > static_cast<double>(weights[i]); i++)
+        {
+          skip -= static_cast<double>(weights[i]);
+        }
+        if (i == end)
+        {
+          break;
+        }
+        // Its key: uniform among those above the smallest one kept
+        const double w = static_cast<double>(weights[i]);
+        const double low = std::exp(w * worst);
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = { std::log(low + (1.0 - low) * RandomUnit(gen)) / w, i };
+        std::push_heap(heap.begin(), heap.end(), better);
+        i++;
+      }
+    });
+  std::vector<Entry> candidates;
+  for (const auto& heap : heaps)
+  {
+    candidates.insert(candidates.end(), heap.begin(), heap.end());
+  }
+  const std::size_t count = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(count), candidates.end(), better);
+  std::vector<std::size_t> sample(count);
+  for (std::size_t i = 0; i < count; i++)
+  {
+    sample[i] = candidates[i].second;
+  }
+  return sample;
+}
+
+class AliasTable
+{
+public:
+  // The weights must be non-negative, and not all zero
+  template <typename Weight>
+  explicit AliasTable(const std::vector<Weight>& weights) : probability(weights.size()), alias(weights.size())
+  {
+    const std::size_t n = weights.size();
+    double total = 0.0;
+    for (const auto& w : weights)
+    {
+      total += static_cast<double>(w);
+    }
+    // Scaled so that the average is 1; each "small" column is topped up from a "large" one
+    std::vector<double> scaled(n);
+    std::vector<std::size_t> small;
+    std::vector<std::size_t> large;
+    for (std::size_t i = 0; i < n; i++)
+    {
+      scaled[i] = static_cast<double>(weights[i]) * static_cast<double>(n) / total;
+      (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty())
+    {
+      std::size_t s = small.back();
+      small.pop_back();
+      std::size_t l = large.back();
+      probability[s] = scaled[s];
+      alias[s] = l;
+      scaled[l] -= 1.0 - scaled[s];
+      if (scaled[l] < 1.0)
+      {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // Left over (up to rounding): full columns
+    for (std::size_t i : large)
+    {
+      probability[i] = 1.0;
+      alias[i] = i;
+    }
+    for (std::size_t i : small)
+    {
+      probability[i] = 1.0;
+      alias[i] = i;
+    }
+  }
+
+  std::size_t operator()(Philox4x32& gen) const
+  {
+    std::size_t column = static_cast<std::size_t>(RandomBelow(gen, probability.size()));
+    return RandomUnit(gen) < probability[column] ? column : alias[column];
+  }
+
+  std::size_t size() const { return probability.size(); }
+
+private:
+  std::vector<double> probability; // of keeping the column's own index
+  std::vector<std::size_t> alias;  // taken otherwise
+};
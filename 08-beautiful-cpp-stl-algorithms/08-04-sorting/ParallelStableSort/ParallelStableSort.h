@@ -0,0 +1,249 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ThreadPool.h"
+
+// A stable merge sort that runs on a `ThreadPool`:
+//   1. the range is cut into one run per thread (or a few more), and the runs are sorted concurrently
+//   2. pairs of neighboring runs are merged, level by level; each merge is itself split into equal
+//      parts via "merge path" partitioning (a binary search for where each part's output starts in
+//      each of the two runs), so all threads keep working even when only one merge is left
+// The merges need a scratch buffer as large as the range; if that exceeds `scratchBudget` (in
+// bytes), the sort merges in place instead, by rotations (no extra memory, but slower, and each
+// merge runs on one thread)
+
+const std::ptrdiff_t StableSortSmallRun = 32;      // sorted via insertion sort
+const std::ptrdiff_t StableSortMinPart = 1 << 14;   // smallest part of a merge worth a task
+
+// Stable insertion sort of [first, last)
+template <typename It, typename Compare>
+void InsertionSortRun(It first, It last, Compare comp)
+{
+  if (first == last)
+  {
+    return;
+  }
+  for (It i = first + 1; i != last; ++i)
+  {
+    auto value = std::move(*i);
+    It j = i;
+    for (; j != first && comp(value, *(j - 1)); --j)
+    {
+      *j = std::move(*(j - 1));
+    }
+    *j = std::move(value);
+  }
+}
+
+// Stable merge of the sorted [first, middle) and [middle, last) without a buffer (by rotations)
+template <typename It, typename Compare>
+void MergeInPlace(It first, It middle, It last, Compare comp)
+{
+  const std::ptrdiff_t len1 = middle - first;
+  const std::ptrdiff_t len2 = last - middle;
+  if (len1 == 0 || len2 == 0)
+  {
+    return;
+  }
+  if (len1 + len2 == 2)
+  {
+    if (comp(*middle, *first))
+    {
+      std::iter_swap(first, middle);
+    }
+    return;
+  }
+  It cut1;
+  It cut2;
+  if (len1 > len2)
+  {
+    cut1 = first + len1 / 2;
+    cut2 = std::lower_bound(middle, last, *cut1, comp);
+  }
+  else
+  {
+    cut2 = middle + len2 / 2;
+    cut1 = std::upper_bound(first, middle, *cut2, comp);
+  }
+  It newMiddle = std::rotate(cut1, middle, cut2);
+  MergeInPlace(first, cut1, newMiddle, comp);
+  MergeInPlace(newMiddle, cut2, last, comp);
+}
+
+// Number of elements of `a` among the first `d` outputs of the stable merge of `a` and `b`
+// (ties go to `a`, which comes first in the original order)
+template <typename It1, typename It2, typename Compare>
+std::ptrdiff_t MergePathSplit(It1 a, std::ptrdiff_t aLength, It2 b, std::ptrdiff_t bLength, std::ptrdiff_t d, Compare comp)
+{
+  std::ptrdiff_t low = std::max<std::ptrdiff_t>(0, d - bLength);
+  std::ptrdiff_t high = std::min(d, aLength);
+  while (low < high)
+  {
+    std::ptrdiff_t i = (low + high) / 2;
+    if (comp(b[d - i - 1], a[i]))
+    {
+      high = i;
+    }
+    else
+    {
+      low = i + 1;
+    }
+  }
+  return low;
+}
+
+// Boundaries of `runs` runs over n elements
+inline std::vector<std::ptrdiff_t> StableSortRunBounds(std::ptrdiff_t n, std::size_t runs)
+{
+  std::vector<std::ptrdiff_t> bounds(runs + 1);
+  for (std::size_t i = 0; i <= runs; i++)
+  {
+    bounds[i] = static_cast<std::ptrdiff_t>(static_cast<double>(n) * static_cast<double>(i) / static_cast<double>(runs));
+  }
+  return bounds;
+}
+
+// One level of merges: neighboring runs of `from` (given by `bounds`) into `to`
+template <typename It1, typename It2, typename Compare>
+void MergeLevel(ThreadPool& pool, It1 from, It2 to, const std::vector<std::ptrdiff_t>& bounds, std::ptrdiff_t partSize, Compare comp)
+{
+  struct Part
+  {
+    std::ptrdiff_t begin, middle, end; // the two runs
+    std::ptrdiff_t d0, d1;             // this part's output range, relative to `begin`
+  };
+  std::vector<Part> parts;
+  for (std::size_t r = 0; r + 1 < bounds.size(); r += 2)
+  {
+    std::ptrdiff_t begin = bounds[r];
+    std::ptrdiff_t middle = bounds[r + 1];
+    std::ptrdiff_t end = r + 2 < bounds.size() ? bounds[r + 2] : middle; // an odd run out is just moved
+    for (std::ptrdiff_t d = 0; d < end - begin; d += partSize)
+    {
+      parts.push_back({ begin, middle, end, d, std::min(d + partSize, end - begin) });
+    }
+  }
+  pool.run(parts.size(), [&](std::size_t i)
+    {
+      const Part& p = parts[i];
+      It1 a = from + p.begin;
+      It1 b = from + p.middle;
+      std::ptrdiff_t aLength = p.middle - p.begin;
+      std::ptrdiff_t bLength = p.end - p.middle;
+      std::ptrdiff_t i0 = MergePathSplit(a, aLength, b, bLength, p.d0, comp);
+      std::ptrdiff_t i1 = MergePathSplit(a, aLength, b, bLength, p.d1, comp);
+      std::merge(std::make_move_iterator(a + i0), std::make_move_iterator(a + i1),
+        std::make_move_iterator(b + (p.d0 - i0)), std::make_move_iterator(b + (p.d1 - i1)), to + p.begin + p.d0, comp);
+    });
+}
+
+template <typename It, typename Compare = std::less<>>
+void ParallelStableSort(ThreadPool& pool, It first, It last, Compare comp = {},
+  std::size_t scratchBudget = std::numeric_limits<std::size_t>::max())
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  const std::ptrdiff_t n = last - first;
+  if (n < 2)
+  {
+    return;
+  }
+  std::size_t runs = std::max<std::size_t>(1, std::min<std::size_t>(pool.size(), static_cast<std::size_t>(n / StableSortMinPart)));
+  const std::ptrdiff_t partSize = std::max<std::ptrdiff_t>(StableSortMinPart, n / static_cast<std::ptrdiff_t>(pool.size() * 4));
+  const bool buffered = std::is_default_constructible_v<T> && static_cast<std::size_t>(n) <= scratchBudget / sizeof(T);
+
+  std::vector<T> scratch;
+  if constexpr (std::is_default_constructible_v<T>)
+  {
+    if (buffered)
+    {
+      scratch.resize(static_cast<std::size_t>(n));
+    }
+  }
+  auto buffer = scratch.begin();
+
+  // Sorts the run [begin, end): insertion-sorted blocks, then merged bottom up (in `scratch`'s
+  // matching slice, or in place)
+  auto sortRun = [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+    {
+      for (std::ptrdiff_t b = begin; b < end; b += StableSortSmallRun)
+      {
+        InsertionSortRun(first + b, first + std::min(b + StableSortSmallRun, end), comp);
+      }
+      bool inScratch = false;
+      for (std::ptrdiff_t width = StableSortSmallRun; width < end - begin; width *= 2)
+      {
+        for (std::ptrdiff_t b = begin; b < end; b += 2 * width)
+        {
+          std::ptrdiff_t m = std::min(b + width, end);
+          std::ptrdiff_t e = std::min(b + 2 * width, end);
+          if (!buffered)
+          {
+            MergeInPlace(first + b, first + m, first + e, comp);
+          }
+          else if (inScratch)
+          {
+            std::merge(std::make_move_iterator(buffer + b), std::make_move_iterator(buffer + m),
+              std::make_move_iterator(buffer + m), std::make_move_iterator(buffer + e), first + b, comp);
+          }
+          else
+          {
+            std::merge(std::make_move_iterator(first + b), std::make_move_iterator(first + m),
+              std::make_move_iterator(first + m), std::make_move_iterator(first + e), buffer + b, comp);
+          }
+        }
+        inScratch = buffered && !inScratch;
+      }
+      if (inScratch)
+      {
+        std::move(buffer + begin, buffer + end, first + begin);
+      }
+    };
+
+  std::vector<std::ptrdiff_t> bounds = StableSortRunBounds(n, runs);
+  pool.run(runs, [&](std::size_t r) { sortRun(bounds[r], bounds[r + 1]); });
+
+  bool inScratch = false;
+  while (bounds.size() > 2)
+  {
+    if (buffered)
+    {
+      if (inScratch)
+      {
+        MergeLevel(pool, buffer, first, bounds, partSize, comp);
+      }
+      else
+      {
+        MergeLevel(pool, first, buffer, bounds, partSize, comp);
+      }
+      inScratch = !inScratch;
+    }
+    else
+    {
+      std::size_t pairs = (bounds.size() - 1) / 2;
+      pool.run(pairs, [&](std::size_t i)
+        {
+          MergeInPlace(first + bounds[2 * i], first + bounds[2 * i + 1], first + bounds[2 * i + 2], comp);
+        });
+    }
+    std::vector<std::ptrdiff_t> merged;
+    for (std::size_t r = 0; r < bounds.size(); r += 2)
+    {
+      merged.push_back(bounds[r]);
+    }
+    if (merged.back() != n)
+    {
+      merged.push_back(n);
+    }
+    bounds.swap(merged);
+  }
+  if (inScratch)
+  {
+    std::move(buffer, buffer + n, first);
+  }
+}
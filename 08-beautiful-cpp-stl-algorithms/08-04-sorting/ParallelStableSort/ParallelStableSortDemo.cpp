@@ -0,0 +1,124 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::is_sorted;
+using std::stable_sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+#include <utility>
+using std::pair;
+#include "ParallelStableSort.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Sorts (key, original position) pairs by key only: the result is stable exactly if it is sorted
+// by (key, position), which `is_sorted()` checks
+bool Validate(mt19937& gen)
+{
+  auto byKey = [](const pair<int, int>& a, const pair<int, int>& b) { return a.first < b.first; };
+  for (unsigned threads : { 1, 2, 3, 4, 8 })
+  {
+    ThreadPool pool(threads);
+    for (size_t n : { 0, 1, 2, 31, 32, 33, 1000, 16'385, 100'003, 1'000'000 })
+    {
+      for (int keys : { 2, 1000, 1'000'000 }) // many ties to none
+      {
+        for (size_t budget : { std::numeric_limits<size_t>::max(), size_t{ 0 } })
+        {
+          if (budget == 0 && n > 100'003)
+          {
+            continue; // in-place merging is slow
+          }
+          uniform_int_distribution<int> dist(0, keys - 1);
+          vector<pair<int, int>> v(n);
+          for (size_t i = 0; i < n; i++)
+          {
+            v[i] = { dist(gen), static_cast<int>(i) };
+          }
+          ParallelStableSort(pool, begin(v), end(v), byKey, budget);
+          if (!is_sorted(begin(v), end(v)))
+          {
+            cout << " FAILED: " << n << " elements, " << keys << " keys, " << threads << " threads, budget " << budget << '\n';
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  // Non-trivial elements (strings), moved rather than copied
+  ThreadPool pool(4);
+  vector<string> words(100'000);
+  uniform_int_distribution<int> letter('a', 'z');
+  for (auto& w : words)
+  {
+    w = string(5, static_cast<char>(letter(gen))) + "-long-enough-to-be-on-the-heap";
+  }
+  auto expected = words;
+  stable_sort(begin(expected), end(expected));
+  ParallelStableSort(pool, begin(words), end(words));
+  return words == expected;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ParallelStableSortDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 10'000'000;
+
+  // Same vector as `Sorting.cpp`
+  ThreadPool pool;
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  ParallelStableSort(pool, begin(v), end(v), [](int elem1, int elem2) { return abs(elem1) > abs(elem2); });
+  for (int x : v)
+  {
+    cout << ' ' << x;
+  }
+  cout << "\n\n";
+
+  mt19937 gen{ 1846 };
+  bool ok = Validate(gen);
+  cout << " validation " << (ok ? "passed" : "FAILED") << "\n\n";
+
+  uniform_int_distribution<int> dist;
+  vector<int> original(n);
+  for (auto& x : original)
+  {
+    x = dist(gen);
+  }
+  auto expected = original;
+  double stdMs = TimeMs([&]() { stable_sort(begin(expected), end(expected)); });
+  cout << ' ' << n << " ints\n std::stable_sort():\t" << stdMs << " ms\n";
+  for (unsigned threads : { 1, 2, 4, 8 })
+  {
+    ThreadPool workers(threads);
+    auto buffered = original;
+    double bufferedMs = TimeMs([&]() { ParallelStableSort(workers, begin(buffered), end(buffered)); });
+    auto inPlace = original;
+    double inPlaceMs = TimeMs([&]() { ParallelStableSort(workers, begin(inPlace), end(inPlace), std::less<>{}, 0); });
+    bool match = buffered == expected && inPlace == expected;
+    cout << ' ' << threads << " thread(s):\t\t" << bufferedMs << " ms (with scratch buffer), " << inPlaceMs
+         << " ms (in place)" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads; `run(count, task)` calls task(0), ..., task(count - 1) on the
+// workers and the calling thread, and returns once all of them are done
+// N.B. don't call `run()` from inside a task
+class ThreadPool
+{
+public:
+  explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency())
+  {
+    threads = std::max(threads, 1u);
+    for (unsigned i = 1; i < threads; i++) // the calling thread is the last one
+    {
+      workers.emplace_back([this] { work(); });
+    }
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wakeup.notify_all();
+    for (auto& t : workers)
+    {
+      t.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+  template <typename Task>
+  void run(std::size_t count, Task task)
+  {
+    if (count == 0)
+    {
+      return;
+    }
+    // Shared with the helper jobs, which may only get to it after `run()` has returned
+    auto state = std::make_shared<RunState>();
+    state->count = count;
+    state->task = std::move(task);
+    std::size_t helpers = std::min<std::size_t>(workers.size(), count - 1);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (std::size_t i = 0; i < helpers; i++)
+      {
+        jobs.emplace_back([state] { state->drain(); });
+      }
+    }
+    if (helpers == 1)
+    {
+      wakeup.notify_one();
+    }
+    else if (helpers > 1)
+    {
+      wakeup.notify_all();
+    }
+    state->drain();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&] { return state->done == state->count; });
+  }
+
+private:
+  struct RunState
+  {
+    std::function<void(std::size_t)> task;
+    std::size_t count = 0;
+    std::atomic<std::size_t> next{ 0 };
+    std::size_t done = 0;
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    void drain()
+    {
+      std::size_t completed = 0;
+      for (std::size_t i; (i = next.fetch_add(1)) < count; completed++)
+      {
+        task(i);
+      }
+      if (completed > 0)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        done += completed;
+        if (done == count)
+        {
+          finished.notify_all();
+        }
+      }
+    }
+  };
+
+  void work()
+  {
+    for (;;)
+    {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (stopping && jobs.empty())
+        {
+          return;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+      job();
+    }
+  }
+
+  std::vector<std::thread> workers;
+  std::deque<std::function<void()>> jobs;
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  bool stopping = false;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Sorting by a computed key, e.g., `Employee::getSortingName()`, which builds a new string on
+// every call: a comparator such as
+//   [](Employee e1, Employee e2) {return e1.getSortingName() < e2.getSortingName(); }
+// copies two employees and builds two names for *every comparison* (about n log n of them),
+// whereas `SortByKey()`/`StableSortByKey()` call `keyOf` exactly once per element, sort
+// (key, position) pairs, and then move each element to its place once
+
+// Elements of [first, last) in the order given by `order` (positions within [first, last))
+template <typename It>
+void ApplyOrder(It first, const std::vector<std::size_t>& order)
+{
+  using T = typename std::iterator_traits<It>::value_type;
+  std::vector<T> sorted;
+  sorted.reserve(order.size());
+  for (std::size_t i : order)
+  {
+    sorted.push_back(std::move(first[static_cast<std::ptrdiff_t>(i)]));
+  }
+  std::move(sorted.begin(), sorted.end(), first);
+}
+
+template <typename It, typename KeyOf, typename Compare, typename Sort>
+void SortByKeyWith(It first, It last, KeyOf keyOf, Compare comp, Sort sortEntries)
+{
+  using Key = std::decay_t<decltype(keyOf(*first))>;
+  std::vector<std::pair<Key, std::size_t>> entries;
+  entries.reserve(static_cast<std::size_t>(last - first));
+  std::size_t i = 0;
+  for (It it = first; it != last; ++it)
+  {
+    entries.emplace_back(keyOf(*it), i++);
+  }
+  sortEntries(entries.begin(), entries.end(),
+    [&comp](const std::pair<Key, std::size_t>& a, const std::pair<Key, std::size_t>& b) { return comp(a.first, b.first); });
+  std::vector<std::size_t> order;
+  order.reserve(entries.size());
+  for (const auto& e : entries)
+  {
+    order.push_back(e.second);
+  }
+  entries.clear(); // free the keys before the elements are moved
+  entries.shrink_to_fit();
+  ApplyOrder(first, order);
+}
+
+// Sorts like `sort(first, last, [](T a, T b) {return comp(keyOf(a), keyOf(b)); })`
+template <typename It, typename KeyOf, typename Compare = std::less<>>
+void SortByKey(It first, It last, KeyOf keyOf, Compare comp = {})
+{
+  SortByKeyWith(first, last, keyOf, comp, [](auto b, auto e, auto c) { std::sort(b, e, c); });
+}
+
+// Same result as `stable_sort(first, last, [](T a, T b) {return comp(keyOf(a), keyOf(b)); })`
+template <typename It, typename KeyOf, typename Compare = std::less<>>
+void StableSortByKey(It first, It last, KeyOf keyOf, Compare comp = {})
+{
+  SortByKeyWith(first, last, keyOf, comp, [](auto b, auto e, auto c) { std::stable_sort(b, e, c); });
+}
@@ -0,0 +1,113 @@
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include <algorithm>
+using std::sort;
+using std::stable_sort;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include "Employee.h"
+#include "SortByKey.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+vector<string> Names(const vector<Employee>& staff)
+{
+  vector<string> names;
+  for (auto& e : staff)
+  {
+    names.push_back(e.getSortingName() + " " + std::to_string(e.getSalary()));
+  }
+  return names;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: SortByKeyDemo [employees]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 1'000'000;
+
+  // Same two-pass sort as `StableSort.cpp`: by name, then (stable) by salary
+  vector<Employee> staff{
+    { "Kate", "Gregory", 1000 },
+    { "Obvious", "Artificial", 2000 },
+    { "Fake", "Name", 1000 },
+    { "Alan", "Turing", 2000 },
+    { "Grace", "Hopper", 2000 },
+    { "Anita", "Borg", 2000 }
+  };
+  SortByKey(begin(staff), end(staff), [](const Employee& e) { return e.getSortingName(); });
+  StableSortByKey(begin(staff), end(staff), [](const Employee& e) { return e.getSalary(); });
+  for (auto& e : staff)
+  {
+    cout << ' ' << e.getSortingName() << " (" << e.getSalary() << ")\n";
+  }
+
+  const vector<string> firstnames{ "Kate", "Alan", "Grace", "Anita", "Ada", "Edsger", "Barbara", "Donald", "Frances", "Niklaus" };
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> letter('a', 'z');
+  uniform_int_distribution<int> length(5, 10);
+  uniform_int_distribution<int> salary(10, 200);
+  uniform_int_distribution<size_t> pick(0, firstnames.size() - 1);
+  vector<Employee> many;
+  many.reserve(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    string last(static_cast<size_t>(length(gen)), ' ');
+    for (auto& c : last)
+    {
+      c = static_cast<char>(letter(gen));
+    }
+    last[0] = static_cast<char>(last[0] - 'a' + 'A');
+    many.emplace_back(firstnames[pick(gen)], last, salary(gen) * 100);
+  }
+  cout << "\n " << n << " employees, by name then (stable) by salary:\n";
+
+  auto byValue = many;
+  double byValueMs = TimeMs([&]()
+    {
+      sort(begin(byValue), end(byValue),
+        [](Employee e1, Employee e2) {return e1.getSortingName() < e2.getSortingName(); });
+      stable_sort(begin(byValue), end(byValue),
+        [](Employee e1, Employee e2) {return e1.getSalary() < e2.getSalary(); });
+    });
+  auto byReference = many;
+  double byReferenceMs = TimeMs([&]()
+    {
+      sort(begin(byReference), end(byReference),
+        [](const Employee& e1, const Employee& e2) {return e1.getSortingName() < e2.getSortingName(); });
+      stable_sort(begin(byReference), end(byReference),
+        [](const Employee& e1, const Employee& e2) {return e1.getSalary() < e2.getSalary(); });
+    });
+  auto byKey = many;
+  double byKeyMs = TimeMs([&]()
+    {
+      SortByKey(begin(byKey), end(byKey), [](const Employee& e) { return e.getSortingName(); });
+      StableSortByKey(begin(byKey), end(byKey), [](const Employee& e) { return e.getSalary(); });
+    });
+
+  auto expected = Names(byValue);
+  bool ok = Names(byReference) == expected && Names(byKey) == expected;
+  cout << "\tcomparators taking Employee by value: " << byValueMs << " ms\n\tcomparators taking Employee by reference: "
+       << byReferenceMs << " ms\n\tSortByKey() + StableSortByKey(): " << byKeyMs << " ms"
+       << (ok ? "" : " -- MISMATCH!") << '\n';
+
+  return ok ? 0 : 1;
+}
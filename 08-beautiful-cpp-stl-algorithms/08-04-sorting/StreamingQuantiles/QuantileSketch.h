@@ -0,0 +1,189 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Approximate quantiles (median, p99, ...) of a stream of any length in bounded memory: a KLL
+// sketch (Karnin, Lang, Liberty, "Optimal Quantile Approximation in Streams", 2016)
+//   * values go into a stack of "compactors"; a value at level h stands for 2^h values of the
+//     stream
+//   * when the sketch is full, the lowest overfull level is sorted and every other value (starting
+//     at a random one of the first two) moves up a level, which halves the level's size and
+//     doubles the weight of the values that remain
+//   * capacities shrink geometrically (by 2/3) from the top level down, so the sketch retains
+//     about 3k values however long the stream, plus a couple per level
+// The rank of any answer is off by about 1.7 / k of the stream length (e.g., within 1% for
+// k = 200) with high probability; `min()` and `max()` are exact
+
+template <typename T, typename Compare = std::less<>>
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(std::size_t k = 200, Compare comp = {}) : k(std::max<std::size_t>(k, 8)), comp(comp)
+  {
+    levels.resize(1);
+    updateCapacities();
+  }
+
+  void add(const T& value)
+  {
+    if (n == 0 || comp(value, minimum))
+    {
+      minimum = value;
+    }
+    if (n == 0 || comp(maximum, value))
+    {
+      maximum = value;
+    }
+    n++;
+    levels[0].push_back(value);
+    if (++retained >= maxRetained)
+    {
+      compress();
+    }
+  }
+
+  template <typename It>
+  void add(It first, It last)
+  {
+    for (; first != last; ++first)
+    {
+      add(*first);
+    }
+  }
+
+  // Approximate value of rank q * count() (0 <= q <= 1), e.g., 0.5 for the median
+  T quantile(double q) const
+  {
+    if (q <= 0.0)
+    {
+      return minimum;
+    }
+    if (q >= 1.0)
+    {
+      return maximum;
+    }
+    auto weighted = weightedValues();
+    const double target = q * static_cast<double>(n);
+    std::uint64_t cumulative = 0;
+    for (const auto& [value, weight] : weighted)
+    {
+      cumulative += weight;
+      if (static_cast<double>(cumulative) >= target)
+      {
+        return value;
+      }
+    }
+    return maximum;
+  }
+
+  // Approximate fraction of the values <= x
+  double rank(const T& x) const
+  {
+    std::uint64_t below = 0;
+    for (std::size_t h = 0; h < levels.size(); h++)
+    {
+      for (const T& value : levels[h])
+      {
+        below += comp(x, value) ? 0 : std::uint64_t{ 1 } << h;
+      }
+    }
+    return n == 0 ? 0.0 : static_cast<double>(below) / static_cast<double>(n);
+  }
+
+  std::uint64_t count() const { return n; }
+  std::size_t retainedValues() const { return retained; } // memory use, in values
+  const T& min() const { return minimum; }
+  const T& max() const { return maximum; }
+
+private:
+  // All retained values with their weights, in `comp` order
+  std::vector<std::pair<T, std::uint64_t>> weightedValues() const
+  {
+    std::vector<std::pair<T, std::uint64_t>> weighted;
+    weighted.reserve(retained);
+    for (std::size_t h = 0; h < levels.size(); h++)
+    {
+      for (const T& value : levels[h])
+      {
+        weighted.emplace_back(value, std::uint64_t{ 1 } << h);
+      }
+    }
+    std::sort(weighted.begin(), weighted.end(), [this](const auto& a, const auto& b) { return comp(a.first, b.first); });
+    return weighted;
+  }
+
+  // Level capacities (and their sum), recomputed whenever a level is added
+  void updateCapacities()
+  {
+    capacities.resize(levels.size());
+    maxRetained = 0;
+    for (std::size_t h = 0; h < levels.size(); h++)
+    {
+      double depth = static_cast<double>(levels.size() - 1 - h);
+      capacities[h] = std::max<std::size_t>(2, static_cast<std::size_t>(std::ceil(static_cast<double>(k) * std::pow(2.0 / 3.0, depth))));
+      maxRetained += capacities[h];
+    }
+  }
+
+  // Compacts the lowest level at or over capacity
+  void compress()
+  {
+    for (std::size_t h = 0; h < levels.size(); h++)
+    {
+      if (levels[h].size() < capacities[h])
+      {
+        continue;
+      }
+      if (h + 1 == levels.size())
+      {
+        levels.emplace_back();
+        updateCapacities();
+      }
+      std::vector<T>& level = levels[h];
+      std::vector<T>& above = levels[h + 1];
+      std::sort(level.begin(), level.end(), comp);
+      // An odd value out stays, so the total weight stays exactly n
+      const std::size_t pairs = level.size() / 2;
+      const std::size_t offset = coin();
+      for (std::size_t i = 0; i < pairs; i++)
+      {
+        above.push_back(std::move(level[2 * i + offset]));
+      }
+      if (level.size() % 2 != 0)
+      {
+        level.front() = std::move(level.back());
+        level.resize(1);
+      }
+      else
+      {
+        level.clear();
+      }
+      retained -= pairs;
+      return;
+    }
+  }
+
+  std::size_t coin()
+  {
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+    return static_cast<std::size_t>(random & 1);
+  }
+
+  std::size_t k;
+  Compare comp;
+  std::vector<std::vector<T>> levels;
+  std::vector<std::size_t> capacities;
+  std::size_t retained = 0;
+  std::size_t maxRetained = 0;
+  std::uint64_t n = 0;
+  T minimum{};
+  T maximum{};
+  std::uint64_t random = 0x2545F4914F6CDD1D; // xorshift64: fixed seed, reproducible results
+};
@@ -0,0 +1,133 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::nth_element;
+using std::partial_sort_copy;
+using std::sort;
+using std::upper_bound;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cmath>
+using std::fabs;
+#include <cstdlib>
+using std::atoll;
+#include <functional>
+using std::greater;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::normal_distribution;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+#include "QuantileSketch.h"
+#include "StreamingTopK.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Streams `data` through both containers, and compares their answers with the exact ones
+template <typename T>
+bool Check(const string& what, const vector<T>& data, size_t k)
+{
+  StreamingTopK<T> smallest(3);
+  StreamingTopK<T, greater<>> largest(3);
+  QuantileSketch<T> sketch(k);
+  double topMs = TimeMs([&]()
+    {
+      smallest.push(begin(data), end(data));
+      largest.push(begin(data), end(data));
+    });
+  double sketchMs = TimeMs([&]() { sketch.add(begin(data), end(data)); });
+
+  auto sorted = data;
+  double exactMs = TimeMs([&]() { nth_element(begin(sorted), begin(sorted) + static_cast<std::ptrdiff_t>(sorted.size() / 2), end(sorted)); });
+  sort(begin(sorted), end(sorted));
+  bool ok = smallest.sorted() == vector<T>(begin(sorted), begin(sorted) + 3)
+    && largest.sorted() == vector<T>(sorted.rbegin(), sorted.rbegin() + 3);
+
+  // Rank error: how far the true rank of each answer is from the one asked for
+  const double n = static_cast<double>(data.size());
+  double worstError = 0.0;
+  for (double q : { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 })
+  {
+    T estimate = sketch.quantile(q);
+    double lowRank = static_cast<double>(std::lower_bound(begin(sorted), end(sorted), estimate) - begin(sorted)) / n;
+    double highRank = static_cast<double>(upper_bound(begin(sorted), end(sorted), estimate) - begin(sorted)) / n;
+    double error = q < lowRank ? lowRank - q : q > highRank ? q - highRank : 0.0; // duplicates cover a range of ranks
+    worstError = std::max(worstError, error);
+  }
+  const double bound = 2.5 / static_cast<double>(k);
+  ok = ok && worstError <= bound && sketch.min() == sorted.front() && sketch.max() == sorted.back();
+
+  cout << ' ' << what << ": median ~" << sketch.quantile(0.5) << " (exact " << sorted[sorted.size() / 2] << "), p99 ~"
+       << sketch.quantile(0.99) << " (exact " << sorted[static_cast<size_t>(n * 0.99)] << ")\n\tworst rank error "
+       << worstError * 100 << "% (bound " << bound * 100 << "%), " << sketch.retainedValues() << " values retained\n\ttop-3 x2 "
+       << topMs << " ms, sketch " << sketchMs << " ms (" << n / sketchMs / 1000 << "M values/s), exact median "
+       << exactMs << " ms" << (ok ? "" : " -- MISMATCH!") << '\n';
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: StreamingQuantilesDemo [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 10'000'000;
+
+  // Same vector as `PartialSorting.cpp`, one value at a time
+  vector<int> v{ 4,1,0,1,-2,3,7,-6,2,0,0,-9,9 };
+  StreamingTopK<int> v3(3);
+  QuantileSketch<int> sketch;
+  for (int x : v)
+  {
+    v3.push(x);
+    sketch.add(x);
+  }
+  cout << " 3 smallest of v:";
+  for (int x : v3.sorted())
+  {
+    cout << ' ' << x;
+  }
+  cout << ", median " << sketch.quantile(0.5) << "\n\n";
+
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> uniform;
+  uniform_int_distribution<int> few(0, 99);
+  normal_distribution<double> normal(100.0, 15.0);
+  vector<int> ints(n);
+  vector<int> duplicates(n);
+  vector<double> doubles(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    ints[i] = uniform(gen);
+    duplicates[i] = few(gen);
+    doubles[i] = normal(gen);
+  }
+  vector<int> ascending(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    ascending[i] = static_cast<int>(i);
+  }
+
+  bool ok = true;
+  for (size_t k : { 200, 1000 })
+  {
+    cout << " k = " << k << ", " << n << " values:\n";
+    ok = Check("uniform ints   ", ints, k) && ok;
+    ok = Check("100 values     ", duplicates, k) && ok;
+    ok = Check("normal doubles ", doubles, k) && ok;
+    ok = Check("ascending ints ", ascending, k) && ok;
+    cout << '\n';
+  }
+
+  return ok ? 0 : 1;
+}
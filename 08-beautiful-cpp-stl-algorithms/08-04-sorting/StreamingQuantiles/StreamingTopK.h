@@ -0,0 +1,59 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// The k first values in `comp` order (by default, the k smallest) of a stream of any length, as
+// `partial_sort_copy()` would give for the whole stream, in O(k) memory: a max-heap (by `comp`)
+// of the best k so far, so most values cost one comparison against its top
+// (e.g., `StreamingTopK<int, std::greater<>>` keeps the k largest)
+template <typename T, typename Compare = std::less<>>
+class StreamingTopK
+{
+public:
+  explicit StreamingTopK(std::size_t k, Compare comp = {}) : k(k), comp(comp)
+  {
+    heap.reserve(k);
+  }
+
+  void push(const T& value)
+  {
+    if (heap.size() < k)
+    {
+      heap.push_back(value);
+      std::push_heap(heap.begin(), heap.end(), comp);
+    }
+    else if (k > 0 && comp(value, heap.front()))
+    {
+      std::pop_heap(heap.begin(), heap.end(), comp);
+      heap.back() = value;
+      std::push_heap(heap.begin(), heap.end(), comp);
+    }
+  }
+
+  template <typename It>
+  void push(It first, It last)
+  {
+    for (; first != last; ++first)
+    {
+      push(*first);
+    }
+  }
+
+  // The (up to) k values so far, in `comp` order
+  std::vector<T> sorted() const
+  {
+    std::vector<T> result = heap;
+    std::sort_heap(result.begin(), result.end(), comp);
+    return result;
+  }
+
+  std::size_t size() const { return heap.size(); }
+  std::size_t capacity() const { return k; }
+
+private:
+  std::size_t k;
+  Compare comp;
+  std::vector<T> heap;
+};
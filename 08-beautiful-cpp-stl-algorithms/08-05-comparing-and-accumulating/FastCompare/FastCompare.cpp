@@ -0,0 +1,156 @@
+#include <vector>
+using std::vector;
+#include <algorithm>
+using std::equal;
+using std::mismatch;
+using std::lexicographical_compare;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <list>
+using std::list;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include <string>
+using std::string;
+#include "FastCompare.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+// Random short ranges with few distinct values, so that many are equal or share a prefix
+template <typename T>
+bool CheckAgainstStd(mt19937& gen, ThreadPool& pool)
+{
+  uniform_int_distribution<int> values(-2, 2);
+  uniform_int_distribution<size_t> length(0, 300);
+  for (int trial = 0; trial < 20'000; trial++)
+  {
+    vector<T> a(length(gen));
+    for (auto& x : a)
+    {
+      x = static_cast<T>(values(gen));
+    }
+    vector<T> b(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(length(gen) % (a.size() + 1)));
+    if (!b.empty() && trial % 2 == 0)
+    {
+      b[length(gen) % b.size()] = static_cast<T>(values(gen));
+    }
+    auto expected = mismatch(begin(a), end(a), begin(b), end(b));
+    if (FastMismatch(begin(a), end(a), begin(b), end(b)) != expected ||
+      ParallelMismatch(&pool, begin(a), end(a), begin(b), end(b)) != expected ||
+      FastEqual(begin(a), end(a), begin(b), end(b)) != equal(begin(a), end(a), begin(b), end(b)) ||
+      FastLexicographicalCompare(begin(a), end(a), begin(b), end(b)) != lexicographical_compare(begin(a), end(a), begin(b), end(b)) ||
+      FastLexicographicalCompare(begin(b), end(b), begin(a), end(a)) != lexicographical_compare(begin(b), end(b), begin(a), end(a)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: FastCompare [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 100'000'000;
+
+  // Same comparison as `Comparing.cpp`
+  vector<int> a{ 1, 2, 3, 4, 5 };
+  vector<int> b{ 1, 2, 0, 4 };
+  auto firstchange = FastMismatch(begin(a), end(a), begin(b), end(b));
+  cout << " a == b: " << FastEqual(begin(a), end(a), begin(b), end(b)) << ", first change at index "
+       << firstchange.first - begin(a) << " (" << *firstchange.first << " vs. " << *firstchange.second
+       << "), a < b: " << FastLexicographicalCompare(begin(a), end(a), begin(b), end(b)) << "\n";
+  list<int> c{ 1, 2, 3, 4, 6 }; // not contiguous: uses `std::mismatch()`
+  cout << " a vs. list {1, 2, 3, 4, 6}: first change at index " << FastMismatch(begin(a), end(a), begin(c)).first - begin(a) << "\n\n";
+
+  ThreadPool pool;
+  mt19937 gen{ 1846 };
+  bool ok = CheckAgainstStd<int>(gen, pool) && CheckAgainstStd<char>(gen, pool) && CheckAgainstStd<unsigned short>(gen, pool)
+    && CheckAgainstStd<long long>(gen, pool);
+  if (!ok)
+  {
+    cout << " MISMATCH against the Standard Library!\n";
+  }
+
+  // Two large buffers that differ only 9/10 of the way in
+  uniform_int_distribution<int> dist;
+  vector<int> x(n);
+  for (auto& e : x)
+  {
+    e = dist(gen);
+  }
+  vector<int> y = x;
+  y[n / 10 * 9] ^= 1;
+
+  bool same = true;
+  bool less = false;
+  size_t index = 0;
+  double equalMs = TimeMs([&]() { same = equal(begin(x), end(x), begin(y), end(y)); });
+  double mismatchMs = TimeMs([&]() { index = mismatch(begin(x), end(x), begin(y), end(y)).first - begin(x); });
+  double lexMs = TimeMs([&]() { less = lexicographical_compare(begin(x), end(x), begin(y), end(y)); });
+  cout << ' ' << n << " ints\n Standard Library:\tequal " << equalMs << " ms, mismatch " << mismatchMs
+       << " ms, lexicographical_compare " << lexMs << " ms\n";
+
+  bool fastSame = true;
+  bool fastLess = false;
+  size_t fastIndex = 0;
+  equalMs = TimeMs([&]() { fastSame = FastEqual(begin(x), end(x), begin(y), end(y)); });
+  mismatchMs = TimeMs([&]() { fastIndex = FastMismatch(begin(x), end(x), begin(y), end(y)).first - begin(x); });
+  lexMs = TimeMs([&]() { fastLess = FastLexicographicalCompare(begin(x), end(x), begin(y), end(y)); });
+  bool match = fastSame == same && fastIndex == index && fastLess == less;
+  cout << " Fast...():\t\tequal " << equalMs << " ms, mismatch " << mismatchMs << " ms, lexicographical_compare "
+       << lexMs << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+  ok = ok && match;
+
+  // Buffers that fit in the cache, compared over and over: not limited by memory bandwidth
+  vector<int> smallX(begin(x), begin(x) + static_cast<std::ptrdiff_t>(std::min<size_t>(n, 16'384)));
+  vector<int> smallY = smallX;
+  smallY.back() ^= 1;
+  size_t total = 0;
+  size_t fastTotal = 0;
+  double stdSmallMs = TimeMs([&]()
+    {
+      for (int r = 0; r < 10'000; r++)
+      {
+        total += mismatch(begin(smallX), end(smallX), begin(smallY), end(smallY)).first - begin(smallX);
+      }
+    });
+  double fastSmallMs = TimeMs([&]()
+    {
+      for (int r = 0; r < 10'000; r++)
+      {
+        fastTotal += FastMismatch(begin(smallX), end(smallX), begin(smallY), end(smallY)).first - begin(smallX);
+      }
+    });
+  cout << ' ' << smallX.size() << " ints x 10000:	mismatch " << stdSmallMs << " ms, FastMismatch " << fastSmallMs
+       << " ms" << (total == fastTotal ? "" : " -- MISMATCH!") << '\n';
+  ok = ok && total == fastTotal;
+
+  for (unsigned threads : { 2, 4, 8 })
+  {
+    ThreadPool workers(threads);
+    equalMs = TimeMs([&]() { fastSame = ParallelEqual(&workers, begin(x), end(x), begin(y), end(y)); });
+    mismatchMs = TimeMs([&]() { fastIndex = ParallelMismatch(&workers, begin(x), end(x), begin(y), end(y)).first - begin(x); });
+    lexMs = TimeMs([&]() { fastLess = ParallelLexicographicalCompare(&workers, begin(x), end(x), begin(y), end(y)); });
+    match = fastSame == same && fastIndex == index && fastLess == less && ParallelEqual(&workers, begin(x), end(x), begin(x), end(x));
+    cout << " Parallel...(), " << threads << " threads:\tequal " << equalMs << " ms, mismatch " << mismatchMs
+         << " ms, lexicographical_compare " << lexMs << " ms" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
+#include "ThreadPool.h"
+
+// `equal()`, `mismatch()` and `lexicographical_compare()` for contiguous ranges (pointers,
+// `std::vector` and `std::string` iterators) of types whose values are equal exactly when their
+// bytes are (integers, characters, enums, pointers -- not floating point, where 0.0 == -0.0)
+// They compare raw bytes 64 at a time (AVX-512: one compare per 64 bytes; AVX2: two per 64), and
+// locate the first differing byte with a bit scan of the compare mask; the `Parallel...()`
+// versions also split very large ranges across a `ThreadPool`
+// Any other ranges fall back to the Standard Library algorithms
+
+template <typename T>
+constexpr bool IsBitwiseComparable = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+template <typename It>
+constexpr bool IsContiguousIterator()
+{
+  using V = typename std::iterator_traits<It>::value_type;
+  if constexpr (std::is_pointer_v<It>)
+  {
+    return true;
+  }
+  else if constexpr (std::is_same_v<V, char> || std::is_same_v<V, wchar_t> || std::is_same_v<V, char16_t> || std::is_same_v<V, char32_t>)
+  {
+    return std::is_same_v<It, typename std::vector<V>::iterator> || std::is_same_v<It, typename std::vector<V>::const_iterator>
+      || std::is_same_v<It, typename std::basic_string<V>::iterator> || std::is_same_v<It, typename std::basic_string<V>::const_iterator>;
+  }
+  else
+  {
+    return std::is_same_v<It, typename std::vector<V>::iterator> || std::is_same_v<It, typename std::vector<V>::const_iterator>;
+  }
+}
+
+template <typename It1, typename It2>
+constexpr bool CanCompareBytes = IsContiguousIterator<It1>() && IsContiguousIterator<It2>()
+  && std::is_same_v<std::remove_cv_t<typename std::iterator_traits<It1>::value_type>, std::remove_cv_t<typename std::iterator_traits<It2>::value_type>>
+  && IsBitwiseComparable<typename std::iterator_traits<It1>::value_type>
+  && !std::is_same_v<typename std::iterator_traits<It1>::value_type, bool>; // vector<bool> iterators aren't contiguous
+
+// Offset of the first differing byte of a[0, bytes) and b[0, bytes), or `bytes` if there is none
+inline std::size_t FirstDifference(const unsigned char* a, const unsigned char* b, std::size_t bytes)
+{
+  std::size_t i = 0;
+#if defined(__AVX512BW__)
+  for (; i + 64 <= bytes; i += 64)
+  {
+    __m512i x = _mm512_loadu_si512(a + i);
+    __m512i y = _mm512_loadu_si512(b + i);
+    if (__mmask64 differ = _mm512_cmpneq_epi8_mask(x, y))
+    {
+      return i + static_cast<std::size_t>(__builtin_ctzll(differ));
+    }
+  }
+#elif defined(__AVX2__)
+  for (; i + 64 <= bytes; i += 64)
+  {
+    __m256i lowEqual = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+    __m256i highEqual = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32)),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32)));
+    if (!_mm256_testc_si256(_mm256_and_si256(lowEqual, highEqual), _mm256_set1_epi8(-1))) // not all equal
+    {
+      unsigned long long equal = static_cast<unsigned>(_mm256_movemask_epi8(lowEqual))
+        | static_cast<unsigned long long>(static_cast<unsigned>(_mm256_movemask_epi8(highEqual))) << 32;
+      return i + static_cast<std::size_t>(__builtin_ctzll(~equal));
+    }
+  }
+#endif
+  for (; i < bytes; i++)
+  {
+    if (a[i] != b[i])
+    {
+      return i;
+    }
+  }
+  return bytes;
+}
+
+template <typename It>
+const unsigned char* FirstByte(It it)
+{
+  return reinterpret_cast<const unsigned char*>(std::addressof(*it));
+}
+
+// Index of the first differing element of [first1, first1 + n) and [first2, first2 + n), or n;
+// with a pool, chunks of the range are compared concurrently, and a thread stops as soon as a
+// difference has been found before the chunk it's about to compare
+template <typename It1, typename It2>
+std::size_t FirstDifferentIndex(ThreadPool* pool, It1 first1, It2 first2, std::size_t n)
+{
+  using T = typename std::iterator_traits<It1>::value_type;
+  if (n == 0)
+  {
+    return 0;
+  }
+  const unsigned char* a = FirstByte(first1);
+  const unsigned char* b = FirstByte(first2);
+  const std::size_t bytes = n * sizeof(T);
+  const std::size_t chunk = std::size_t{ 1 } << 18; // bytes
+  if (pool == nullptr || bytes < 4 * chunk)
+  {
+    return FirstDifference(a, b, bytes) / sizeof(T);
+  }
+  const std::size_t chunks = (bytes + chunk - 1) / chunk;
+  std::atomic<std::size_t> best{ bytes };
+  pool->run(chunks, [&](std::size_t i)
+    {
+      std::size_t begin = i * chunk;
+      if (best.load(std::memory_order_relaxed) < begin)
+      {
+        return;
+      }
+      std::size_t length = std::min(chunk, bytes - begin);
+      std::size_t offset = FirstDifference(a + begin, b + begin, length);
+      if (offset == length)
+      {
+        return; // no difference in this chunk
+      }
+      std::size_t found = begin + offset;
+      std::size_t current = best.load(std::memory_order_relaxed);
+      while (found < current && !best.compare_exchange_weak(current, found, std::memory_order_relaxed))
+      {
+      }
+    });
+  return best.load() / sizeof(T);
+}
+
+template <typename It1, typename It2>
+std::pair<It1, It2> ParallelMismatch(ThreadPool* pool, It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  if constexpr (CanCompareBytes<It1, It2>)
+  {
+    auto n = static_cast<std::size_t>(std::min(last1 - first1, last2 - first2));
+    auto i = static_cast<std::ptrdiff_t>(FirstDifferentIndex(pool, first1, first2, n));
+    return { first1 + i, first2 + i };
+  }
+  else
+  {
+    return std::mismatch(first1, last1, first2, last2);
+  }
+}
+
+template <typename It1, typename It2>
+std::pair<It1, It2> FastMismatch(It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  return ParallelMismatch(nullptr, first1, last1, first2, last2);
+}
+
+template <typename It1, typename It2>
+std::pair<It1, It2> FastMismatch(It1 first1, It1 last1, It2 first2)
+{
+  if constexpr (CanCompareBytes<It1, It2>)
+  {
+    return ParallelMismatch(nullptr, first1, last1, first2, first2 + (last1 - first1));
+  }
+  else
+  {
+    return std::mismatch(first1, last1, first2);
+  }
+}
+
+template <typename It1, typename It2>
+bool ParallelEqual(ThreadPool* pool, It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  if (std::distance(first1, last1) != std::distance(first2, last2))
+  {
+    return false;
+  }
+  return ParallelMismatch(pool, first1, last1, first2, last2).first == last1;
+}
+
+template <typename It1, typename It2>
+bool FastEqual(It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  return ParallelEqual(nullptr, first1, last1, first2, last2);
+}
+
+template <typename It1, typename It2>
+bool ParallelLexicographicalCompare(ThreadPool* pool, It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  if constexpr (CanCompareBytes<It1, It2>)
+  {
+    auto [a, b] = ParallelMismatch(pool, first1, last1, first2, last2);
+    if (a != last1 && b != last2)
+    {
+      return *a < *b; // the elements themselves decide (not their bytes, e.g., for negative ints)
+    }
+    return a == last1 && b != last2; // a proper prefix
+  }
+  else
+  {
+    return std::lexicographical_compare(first1, last1, first2, last2);
+  }
+}
+
+template <typename It1, typename It2>
+bool FastLexicographicalCompare(It1 first1, It1 last1, It2 first2, It2 last2)
+{
+  return ParallelLexicographicalCompare(nullptr, first1, last1, first2, last2);
+}
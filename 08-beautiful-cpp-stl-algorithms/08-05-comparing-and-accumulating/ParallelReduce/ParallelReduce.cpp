@@ -0,0 +1,102 @@
+#include <vector>
+using std::vector;
+#include <numeric>
+using std::accumulate;
+using std::reduce;
+#include <string>
+using std::string;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <cmath>
+using std::pow;
+#include <cstring>
+using std::memcmp;
+#include <iostream>
+using std::cout;
+#include <iomanip>
+using std::setprecision;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+#include "ParallelReduce.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: ParallelReduce [elements]
+  size_t n = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 50'000'000;
+
+  // Same totals as `Total.cpp`
+  ThreadPool pool;
+  vector<int> a{ 1, 2, 3, 4, 5 };
+  int total = ParallelReduce(pool, begin(a), end(a), 0);
+  int evens = ParallelTransformReduce(pool, begin(a), end(a), 0, std::plus<>{}, [](int i) { return i % 2 == 0 ? i : 0; });
+  int product = ParallelReduce(pool, begin(a), end(a), 1, [](int total, int i) { return total * i; });
+  vector<string> words{ "one","two","three" };
+  string allwords = ParallelReduce(pool, begin(words), end(words), string{}); // `+` on strings isn't commutative
+  cout << " total " << total << ", evens " << evens << ", product " << product << ", words \"" << allwords << "\"\n\n";
+
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> ints(-1000, 1000);
+  uniform_real_distribution<double> magnitudes(-8.0, 8.0);
+  uniform_int_distribution<int> signs(0, 1);
+  vector<long long> numbers(n);
+  vector<double> reals(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    numbers[i] = ints(gen);
+    reals[i] = (signs(gen) ? 1.0 : -1.0) * pow(10.0, magnitudes(gen)); // wildly varying magnitudes
+  }
+
+  long long intSum = 0;
+  long long intReduce = 0;
+  double realSum = 0.0;
+  double realReduce = 0.0;
+  double intAccumulateMs = TimeMs([&]() { intSum = accumulate(begin(numbers), end(numbers), 0LL); });
+  double intReduceMs = TimeMs([&]() { intReduce = reduce(begin(numbers), end(numbers), 0LL); });
+  double realAccumulateMs = TimeMs([&]() { realSum = accumulate(begin(reals), end(reals), 0.0); });
+  double realReduceMs = TimeMs([&]() { realReduce = reduce(begin(reals), end(reals), 0.0); });
+  long double exact = 0.0L;
+  for (double x : reals)
+  {
+    exact += x; // wider intermediate sum, as a reference
+  }
+  cout << ' ' << n << " long longs / doubles\n accumulate:\t" << intAccumulateMs << " ms / "
+       << realAccumulateMs << " ms (sum " << setprecision(17) << realSum << setprecision(6) << ")\n reduce:\t" << intReduceMs << " ms / " << realReduceMs
+       << " ms (sum " << setprecision(17) << realReduce << setprecision(6) << ")\n long double reference sum: " << setprecision(17) << static_cast<double>(exact) << setprecision(6) << "\n";
+
+  bool ok = intReduce == intSum;
+  double firstSum = 0.0;
+  for (unsigned threads : { 1, 2, 4, 8 })
+  {
+    ThreadPool workers(threads);
+    long long parallelInt = 0;
+    double parallelReal = 0.0;
+    double intMs = TimeMs([&]() { parallelInt = ParallelReduce(workers, begin(numbers), end(numbers), 0LL); });
+    double realMs = TimeMs([&]() { parallelReal = ParallelSum(workers, begin(reals), end(reals)); });
+    if (threads == 1)
+    {
+      firstSum = parallelReal;
+    }
+    bool match = parallelInt == intSum && memcmp(&parallelReal, &firstSum, sizeof(double)) == 0; // bit for bit
+    cout << ' ' << threads << " thread(s):\t" << intMs << " ms / " << realMs << " ms (sum " << setprecision(17) << parallelReal << setprecision(6) << ")"
+         << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "ThreadPool.h"
+
+// Parallel `accumulate()`/`reduce()` on a `ThreadPool`, with results that don't depend on the
+// number of threads: the range is always cut into the same fixed-size chunks, each chunk is
+// reduced left to right into its own partial result, and the partials are then combined in
+// chunk order -- so `op` must be associative, but need not be commutative (e.g., string `+`)
+// Floating-point addition isn't associative, so `ParallelSum()` additionally uses Neumaier's
+// compensated summation: still the same bits for any number of threads, and more accurate
+
+const std::ptrdiff_t ReduceChunk = 1 << 16;
+
+inline std::size_t ReduceChunkCount(std::ptrdiff_t n)
+{
+  return static_cast<std::size_t>((n + ReduceChunk - 1) / ReduceChunk);
+}
+
+// Same as `std::accumulate(first, last, init, op)` if `op` is associative
+template <typename It, typename T, typename BinaryOp, typename Transform>
+T ParallelTransformReduce(ThreadPool& pool, It first, It last, T init, BinaryOp op, Transform transform)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = ReduceChunkCount(n);
+  std::vector<T> partials(chunks);
+  pool.run(chunks, [&](std::size_t i)
+    {
+      It begin = first + static_cast<std::ptrdiff_t>(i) * ReduceChunk;
+      It end = first + std::min(static_cast<std::ptrdiff_t>(i + 1) * ReduceChunk, n);
+      T partial = transform(*begin);
+      for (++begin; begin != end; ++begin)
+      {
+        partial = op(std::move(partial), transform(*begin));
+      }
+      partials[i] = std::move(partial);
+    });
+  for (auto& partial : partials)
+  {
+    init = op(std::move(init), std::move(partial));
+  }
+  return init;
+}
+
+template <typename It, typename T, typename BinaryOp>
+T ParallelReduce(ThreadPool& pool, It first, It last, T init, BinaryOp op)
+{
+  return ParallelTransformReduce(pool, first, last, std::move(init), op, [](const auto& x) -> const auto& { return x; });
+}
+
+template <typename It, typename T>
+T ParallelReduce(ThreadPool& pool, It first, It last, T init)
+{
+  return ParallelReduce(pool, first, last, std::move(init), std::plus<>{});
+}
+
+// A running floating-point sum plus the low-order bits lost along the way
+struct NeumaierSum
+{
+  double sum = 0.0;
+  double compensation = 0.0;
+
+  void add(double x)
+  {
+    double t = sum + x;
+    if (std::fabs(sum) >= std::fabs(x))
+    {
+      compensation += (sum - t) + x;
+    }
+    else
+    {
+      compensation += (x - t) + sum;
+    }
+    sum = t;
+  }
+
+  double value() const { return sum + compensation; }
+};
+
+// Sum of [first, last) as `double`, identical for any number of threads
+template <typename It>
+double ParallelSum(ThreadPool& pool, It first, It last)
+{
+  const std::ptrdiff_t n = last - first;
+  const std::size_t chunks = ReduceChunkCount(n);
+  std::vector<NeumaierSum> partials(chunks);
+  pool.run(chunks, [&](std::size_t i)
+    {
+      It begin = first + static_cast<std::ptrdiff_t>(i) * ReduceChunk;
+      It end = first + std::min(static_cast<std::ptrdiff_t>(i + 1) * ReduceChunk, n);
+      NeumaierSum lanes[4]; // four independent sums keep the CPU busy; still a fixed order
+      std::ptrdiff_t count = end - begin;
+      std::ptrdiff_t k = 0;
+      for (; k + 4 <= count; k += 4)
+      {
+        for (int lane = 0; lane < 4; lane++)
+        {
+          lanes[lane].add(static_cast<double>(begin[k + lane]));
+        }
+      }
+      for (; k < count; k++)
+      {
+        lanes[0].add(static_cast<double>(begin[k]));
+      }
+      for (int lane = 1; lane < 4; lane++)
+      {
+        lanes[0].add(lanes[lane].sum);
+        lanes[0].add(lanes[lane].compensation);
+      }
+      partials[i] = lanes[0];
+    });
+  NeumaierSum total;
+  for (const auto& partial : partials)
+  {
+    total.add(partial.sum);
+    total.add(partial.compensation);
+  }
+  return total.value();
+}
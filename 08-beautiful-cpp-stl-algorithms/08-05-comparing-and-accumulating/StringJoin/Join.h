@@ -0,0 +1,91 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Joins a range of strings (anything convertible to `std::string_view`), characters or integers
+// into one string, e.g., Join(begin(words), end(words), " ", "Words: ") -> "Words: one two three"
+// Unlike `accumulate(..., [](const string& total, const string& s) { return total + " " + s; })`,
+// which copies the whole string so far for every element (quadratic time, one allocation per
+// element), this first adds up the final length, allocates once, then copies each element once
+// (integers are written in place via `std::to_chars()`, after reserving their maximum length)
+// `char`, `signed char` and `unsigned char` are characters, not numbers; `bool` and the wide
+// character types are rejected at compile time
+
+// The integer types that are appended as one character, like `std::string::push_back()` does
+template <typename T>
+constexpr bool IsJoinCharacter = std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+// Most characters `std::to_chars()` writes for any `T`, including the '-'
+template <typename T>
+constexpr std::size_t MaxDecimalLength = std::numeric_limits<T>::digits10 + 1 + (std::is_signed_v<T> ? 1 : 0);
+
+template <typename It>
+std::string Join(It first, It last, std::string_view separator, std::string_view prefix = {})
+{
+  using T = std::remove_cv_t<typename std::iterator_traits<It>::value_type>;
+  static_assert(!std::is_same_v<T, bool>, "Join() doesn't format bools: transform them to strings first");
+  static_assert(!std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>,
+    "Join() builds a std::string: convert wide characters first");
+  // Sizing pass
+  std::size_t length = prefix.size();
+  std::size_t count = 0;
+  for (It it = first; it != last; ++it, ++count)
+  {
+    if constexpr (IsJoinCharacter<T>)
+    {
+      length += 1;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+      length += MaxDecimalLength<T>; // an upper bound: cheaper than counting the digits
+    }
+    else
+    {
+      length += std::string_view(*it).size();
+    }
+  }
+  if (count > 1)
+  {
+    length += (count - 1) * separator.size();
+  }
+
+  // One allocation, then each character is written once
+  std::string result(length, '\0');
+  char* out = result.data();
+  out = std::copy(prefix.begin(), prefix.end(), out);
+  for (It it = first; it != last; ++it)
+  {
+    if (it != first)
+    {
+      out = std::copy(separator.begin(), separator.end(), out);
+    }
+    if constexpr (IsJoinCharacter<T>)
+    {
+      *out++ = static_cast<char>(*it);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+      out = std::to_chars(out, result.data() + length, *it).ptr;
+    }
+    else
+    {
+      std::string_view s(*it);
+      out = std::copy(s.begin(), s.end(), out);
+    }
+  }
+  result.resize(static_cast<std::size_t>(out - result.data())); // only shrinks (integers): no reallocation
+  return result;
+}
+
+// Same as `std::accumulate(first, last, std::string{})` for strings
+template <typename It>
+std::string Concat(It first, It last)
+{
+  return Join(first, last, {});
+}
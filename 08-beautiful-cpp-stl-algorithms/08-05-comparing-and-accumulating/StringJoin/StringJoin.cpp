@@ -0,0 +1,106 @@
+#include <vector>
+using std::vector;
+#include <numeric>
+using std::accumulate;
+#include <string>
+using std::string;
+using std::to_string;
+#include <chrono>
+using std::chrono::steady_clock;
+using std::chrono::duration;
+#include <cstdlib>
+using std::atoll;
+#include <iostream>
+using std::cout;
+#include <random>
+using std::mt19937;
+using std::uniform_int_distribution;
+#include "Join.h"
+
+
+template <typename Func>
+double TimeMs(Func f)
+{
+  auto begin = steady_clock::now();
+  f();
+  auto end = steady_clock::now();
+
+  return duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char* argv[])
+{
+  // usage: StringJoin [largest count] -- from 10^3 up to the largest (default 10^7); the quadratic
+  // `accumulate()` idiom only runs up to 10^5 elements
+  size_t largest = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 10'000'000;
+
+  // Same strings as `Total.cpp`
+  vector<int> a{ 1, 2, 3, 4, 5 };
+  vector<string> words{ "one","two","three" };
+  vector<char> letters{ 'a', 'b', 'c' };
+  cout << " \"" << Concat(begin(words), end(words)) << "\", \"" << Join(begin(words), end(words), " ", "Words: ")
+       << "\", \"" << Join(begin(a), end(a), " ", "The numbers are: ") << "\", \"" << Join(begin(letters), end(letters), ", ", "Letters: ")
+       << "\"\n\n";
+  bool ok = Join(begin(letters), end(letters), ", ") == "a, b, c"; // characters, not their codes
+
+  mt19937 gen{ 1846 };
+  uniform_int_distribution<int> dist(-1'000'000, 1'000'000);
+  const vector<string> planets{ "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune" };
+  for (size_t count = 1000; count <= largest; count *= 10)
+  {
+    vector<string> names(count);
+    vector<int> numbers(count);
+    for (size_t i = 0; i < count; i++)
+    {
+      names[i] = planets[i % planets.size()];
+      numbers[i] = dist(gen);
+    }
+
+    string expected;
+    string expectedNumbers;
+    double appendMs = TimeMs([&]()
+      {
+        expected = "Words:";
+        for (const auto& s : names)
+        {
+          expected += " " + s;
+        }
+      });
+    double appendNumbersMs = TimeMs([&]()
+      {
+        expectedNumbers = "The numbers are:";
+        for (int i : numbers)
+        {
+          expectedNumbers += " " + to_string(i);
+        }
+      });
+    string joined;
+    string joinedNumbers;
+    double joinMs = TimeMs([&]() { joined = Join(begin(names), end(names), " ", "Words: "); });
+    double joinNumbersMs = TimeMs([&]() { joinedNumbers = Join(begin(numbers), end(numbers), " ", "The numbers are: "); });
+    bool match = joined == expected && joinedNumbers == expectedNumbers;
+
+    cout << ' ' << count << " elements:\n";
+    if (count <= 100'000)
+    {
+      string accumulated;
+      string accumulatedNumbers;
+      double accumulateMs = TimeMs([&]()
+        {
+          accumulated = accumulate(begin(names), end(names), string{"Words:"}, [](const string& total, const string& s) {return total + " " + s; });
+        });
+      double accumulateNumbersMs = TimeMs([&]()
+        {
+          accumulatedNumbers = accumulate(begin(numbers), end(numbers), string{"The numbers are:"},
+            [](const string& total, int i) {return total + " " + to_string(i); });
+        });
+      cout << "\taccumulate():\t" << accumulateMs << " ms (strings), " << accumulateNumbersMs << " ms (ints)\n";
+      match = match && accumulated == expected && accumulatedNumbers == expectedNumbers;
+    }
+    cout << "\t+= loop:\t" << appendMs << " ms (strings), " << appendNumbersMs << " ms (ints)\n\tJoin():\t\t" << joinMs
+         << " ms (strings), " << joinNumbersMs << " ms (ints)" << (match ? "" : " -- MISMATCH!") << '\n';
+    ok = ok && match;
+  }
+
+  return ok ? 0 : 1;
+}